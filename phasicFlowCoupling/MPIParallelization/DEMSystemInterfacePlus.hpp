@@ -0,0 +1,122 @@
+/*------------------------------- phasicFlow ---------------------------------
+      O        C enter of
+     O O       E ngineering and
+    O   O      M ultiscale modeling of
+   OOOOOOO     F luid flow
+------------------------------------------------------------------------------
+  Copyright (C): www.cemf.ir
+  email: hamid.r.norouzi AT gmail.com
+------------------------------------------------------------------------------
+Licence:
+  This file is part of phasicFlow code. It is a free software for simulating
+  granular and multiphase flows. You can redistribute it and/or modify it under
+  the terms of GNU General Public License v3 or any other later versions.
+
+  phasicFlow is distributed to help others in their research in the field of
+  granular and multiphase flows, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+-----------------------------------------------------------------------------*/
+
+/**
+ * @class DEMSystemInterface
+ * @brief Interface of the DEM system which procDEMSystem forwards calls to.
+ *
+ * procDEMSystem holds one object of this interface on the main processor
+ * (nullptr on other processors). Implementations are phasicFlowDEMSystem, 
+ * which wraps a phasicFlow DEMSystem, and standInDEMSystem. 
+ */
+
+#ifndef __DEMSystemInterfacePlus_hpp__
+#define __DEMSystemInterfacePlus_hpp__
+
+// from std
+#include <vector>
+
+// from phasicFlow
+#include "types.hpp"
+#include "span.hpp"
+#include "box.hpp"
+
+namespace pFlow
+{
+class Timers;
+}
+
+namespace pFlow::Plus
+{
+
+class DEMSystemInterface
+{
+public:
+
+	DEMSystemInterface() = default;
+
+	virtual ~DEMSystemInterface() = default;
+
+	/// Start time of DEM simulation
+	virtual 
+	real startTime()const = 0;
+
+	virtual 
+	bool beforeIteration() = 0;
+
+	/// Find particles in the domains, extended by extentFraction times
+	/// the largest particle diameter
+	virtual 
+	bool updateParticleDistribution(
+		real extentFraction,
+		const std::vector<box>& domains) = 0;
+
+	virtual 
+	std::vector<int32> numParInDomains()const = 0;
+
+	virtual 
+	span<const int32> parIndexInDomain(int32 di)const = 0;
+
+	virtual 
+	span<uint32> particleId() = 0;
+
+	virtual 
+	span<realx3> position() = 0;
+
+	virtual 
+	span<realx3> velocity() = 0;
+
+	virtual 
+	span<realx3> rVelocity() = 0;
+
+	virtual 
+	span<realx3> parFluidForce() = 0;
+
+	virtual 
+	span<realx3> parFluidTorque() = 0;
+
+	virtual 
+	span<real> diameter() = 0;
+
+	virtual 
+	span<real> courseGrainFactor() = 0;
+
+	virtual 
+	bool sendFluidForceToDEM() = 0;
+
+	virtual 
+	bool sendFluidTorqueToDEM() = 0;
+
+	/// Iterate DEM up to time upToTime (and write DEM data if writeTime)
+	virtual 
+	bool iterate(real upToTime, bool writeTime, const word& timeName) = 0;
+
+	/// Timers of DEM (nullptr if DEM has no timers)
+	virtual 
+	Timers* timers()
+	{
+		return nullptr;
+	}
+
+};
+
+} // pFlow::Plus
+
+#endif //__DEMSystemInterfacePlus_hpp__
@@ -0,0 +1,150 @@
+/*------------------------------- phasicFlow ---------------------------------
+      O        C enter of
+     O O       E ngineering and
+    O   O      M ultiscale modeling of
+   OOOOOOO     F luid flow
+------------------------------------------------------------------------------
+  Copyright (C): www.cemf.ir
+  email: hamid.r.norouzi AT gmail.com
+------------------------------------------------------------------------------
+Licence:
+  This file is part of phasicFlow code. It is a free software for simulating
+  granular and multiphase flows. You can redistribute it and/or modify it under
+  the terms of GNU General Public License v3 or any other later versions.
+
+  phasicFlow is distributed to help others in their research in the field of
+  granular and multiphase flows, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+-----------------------------------------------------------------------------*/
+
+/**
+ * @class phasicFlowDEMSystem
+ * @brief DEMSystemInterface of a phasicFlow DEMSystem (main processor).
+ */
+
+#ifndef __phasicFlowDEMSystemPlus_hpp__
+#define __phasicFlowDEMSystemPlus_hpp__
+
+// from phasicFlow
+#include "typeInfo.hpp"
+#include "DEMSystem.hpp"
+
+// from coupling-phasicFlow
+#include "DEMSystemInterfacePlus.hpp"
+
+namespace pFlow::Plus
+{
+
+class phasicFlowDEMSystem
+:
+	public DEMSystemInterface
+{
+private:
+
+	uniquePtr<DEMSystem> 	demSystem_;
+
+public:
+
+	TypeInfoNV("phasicFlowDEMSystem");
+
+	explicit phasicFlowDEMSystem(uniquePtr<DEMSystem>&& demSystem)
+	:
+		demSystem_(std::move(demSystem))
+	{}
+
+	real startTime()const override
+	{
+		return demSystem_->Control().time().startTime();
+	}
+
+	bool beforeIteration() override
+	{
+		return demSystem_->beforeIteration();
+	}
+
+	bool updateParticleDistribution(
+		real extentFraction,
+		const std::vector<box>& domains) override
+	{
+		return demSystem_->updateParticleDistribution(extentFraction, domains);
+	}
+
+	std::vector<int32> numParInDomains()const override
+	{
+		return demSystem_->numParInDomains();
+	}
+
+	span<const int32> parIndexInDomain(int32 di)const override
+	{
+		return demSystem_->parIndexInDomain(di);
+	}
+
+	span<uint32> particleId() override
+	{
+		return demSystem_->particleId();
+	}
+
+	span<realx3> position() override
+	{
+		return demSystem_->position();
+	}
+
+	span<realx3> velocity() override
+	{
+		return demSystem_->velocity();
+	}
+
+	span<realx3> rVelocity() override
+	{
+		return demSystem_->rVelocity();
+	}
+
+	span<realx3> parFluidForce() override
+	{
+		return demSystem_->parFluidForce();
+	}
+
+	span<realx3> parFluidTorque() override
+	{
+		return demSystem_->parFluidTorque();
+	}
+
+	span<real> diameter() override
+	{
+		return demSystem_->diameter();
+	}
+
+	span<real> courseGrainFactor() override
+	{
+		return demSystem_->courseGrainFactor();
+	}
+
+	bool sendFluidForceToDEM() override
+	{
+		return demSystem_->sendFluidForceToDEM();
+	}
+
+	bool sendFluidTorqueToDEM() override
+	{
+		return demSystem_->sendFluidTorqueToDEM();
+	}
+
+	bool iterate(real upToTime, bool writeTime, const word& timeName) override
+	{
+		if(writeTime)
+			return demSystem_->iterate(upToTime, upToTime, timeName);
+		else
+			return demSystem_->iterate(upToTime);
+	}
+
+	Timers* timers() override
+	{
+		return &demSystem_->Control().timers();
+	}
+
+};
+
+} // pFlow::Plus
+
+#endif //__phasicFlowDEMSystemPlus_hpp__
@@ -23,12 +23,14 @@ Licence:
 
 
 // from phasicFlow
-#include "DEMSystem.hpp"
 #include "box.hpp"
+#include "uniquePtr.hpp"
 
 
 // from coupling-phasicFlow
 #include "procVectorPlus.hpp"
+#include "DEMSystemInterfacePlus.hpp"
+#include "standInDEMSystemPlus.hpp"
 
 
 namespace pFlow
@@ -45,8 +47,9 @@ class procDEMSystem
 protected:
 
 	// this will be nullptr for all processors except 
-	// the main processor 
-	uniquePtr<DEMSystem> demSystem_ = nullptr;
+	// the main processor. It is a phasicFlowDEMSystem or a 
+	// standInDEMSystem (when demSystemName is standInDEMSystem)
+	uniquePtr<DEMSystemInterface> demSystem_ = nullptr;
 
 	real 				 startTime_= 0;
 public:
@@ -66,153 +69,86 @@ public:
 	inline 
 	bool getDataFromDEM()
 	{
-		if(demSystem_)
-		{
-			return demSystem_->beforeIteration();
-		}
-		else
-		{
-			return true;
-		}
+		if(!demSystem_) return true;
+		return demSystem_->beforeIteration();
 	}
 
 	
 	bool updateParticleDistribution(real extentFraction, const procVector<box>& domains)
 	{
-		if(demSystem_)
-		{
-			/*demSystem_->updateParticleDistribution(extentFraction, domains);
-			output<<"numProcessos "<< domains.size()<<endl;
-			output<<" num in Proc0 "<<demSystem_->numParInDomain(0)<<endl;*/
-			
-			return demSystem_->updateParticleDistribution(extentFraction, domains);
-		}
-		else
-		{
-			return true;
-		}
+		if(!demSystem_) return true;
+		return demSystem_->updateParticleDistribution(extentFraction, domains);
 	}
 
 	inline 
 	span<const int32> parIndexInDomain(int32 di)const
 	{
-		if(demSystem_)
-		{
-			return demSystem_->parIndexInDomain(di);
-		}else
-		{
-			return span<const int32>();
-		}
+		if(!demSystem_) return span<const int32>();
+		return demSystem_->parIndexInDomain(di);
 	}
 
 	inline
 	span<uint32> particleIdAllMaster()const
 	{
-		if(demSystem_)
-		{
-			return demSystem_->particleId();
-		}else
-		{
-			return span<uint32>();
-		}
+		if(!demSystem_) return span<uint32>();
+		return demSystem_->particleId();
 	}
 
 	inline 
 	span<realx3> particlesCenterMassAllMaster()
 	{
-		if(demSystem_)
-		{
-			return demSystem_->position();
-		}else
-		{
-			return span<realx3>();
-		}
+		if(!demSystem_) return span<realx3>();
+		return demSystem_->position();
 	}
 
 	inline 
 	span<realx3> particlesVelocityAllMaster()
 	{
-		if(demSystem_)
-		{
-			return demSystem_->velocity();
-		}else
-		{
-			return span<realx3>();
-		}
+		if(!demSystem_) return span<realx3>();
+		return demSystem_->velocity();
 	}
 
 	inline 
 	span<realx3> particlesRVelocityAllMaster()
 	{
-		if(demSystem_)
-		{
-			return demSystem_->rVelocity();
-		}else
-		{
-			return span<realx3>();
-		}
+		if(!demSystem_) return span<realx3>();
+		return demSystem_->rVelocity();
 	}
 
 
 	inline 
 	span<realx3> particlesFluidForceAllMaster()
 	{
-		if(demSystem_)
-		{
-			return demSystem_->parFluidForce();
-		}else
-		{
-			return span<realx3>();
-		}
+		if(!demSystem_) return span<realx3>();
+		return demSystem_->parFluidForce();
 	}
 
 	inline
 	span<realx3> particlesFluidTorqueAllMaster()
 	{
-		if(demSystem_)
-		{
-			return demSystem_->parFluidTorque();
-		}else
-		{
-			return span<realx3>();
-		}
+		if(!demSystem_) return span<realx3>();
+		return demSystem_->parFluidTorque();
 	}
 
 	inline
 	span<real> particlesDiameterAllMaster()
 	{
-		if(demSystem_)
-		{
-			return demSystem_->diameter();
-		}else
-		{
-			return span<real>();
-		}		
+		if(!demSystem_) return span<real>();
+		return demSystem_->diameter();
 	}
 
 	inline
 	span<real> particlesCourseGrainFactorMasterAllMaster()
 	{
-		if(demSystem_)
-		{
-			return demSystem_->courseGrainFactor();
-		}else
-		{
-			return span<real>();
-		}		
+		if(!demSystem_) return span<real>();
+		return demSystem_->courseGrainFactor();
 	}
 
 	inline
 	procVector<int32> numParInDomainMaster()const
 	{
-		if(demSystem_)
-		{
-			return demSystem_->numParInDomains();
-		}
-		else
-		{
-			return procVector<int32>(true);
-		}
+		if(!demSystem_) return procVector<int32>(true);
+		return demSystem_->numParInDomains();
 	}
 
 
@@ -234,70 +170,43 @@ public:
 	inline 
 	bool sendFluidForceToDEM()
 	{
-		if(demSystem_)
-		{
-			return demSystem_->sendFluidForceToDEM();
-		}
-		else
-		{
-			return true;
-		}
+		if(!demSystem_) return true;
+		return demSystem_->sendFluidForceToDEM();
 	}
 
 	inline
 	bool sendFluidTorqueToDEM()
 	{
-		if(demSystem_)
-		{
-			return demSystem_->sendFluidTorqueToDEM();
-		}
-		else
-		{
-			return true;
-		}
+		if(!demSystem_) return true;
+		return demSystem_->sendFluidTorqueToDEM();
 	}
 
 	inline
 	bool iterate(real upToTime, bool writeTime, const word& timeName)
 	{
-		
-		if(demSystem_)
-		{
-			if(writeTime)
-				return demSystem_->iterate(upToTime, upToTime, timeName);
-			else
-				return demSystem_->iterate(upToTime);
-		}
-		else
-		{
-			return true;
-		}
+		if(!demSystem_) return true;
+		return demSystem_->iterate(upToTime, writeTime, timeName);
 	}
 
 	inline
 	bool iterate(real upToTime)
 	{
-		if(demSystem_)
-		{
-			return demSystem_->iterate(upToTime);
-		}
-		else
-		{
-			return true;
-		}
+		return iterate(upToTime, false, "");
+	}
+
+	/// The stand-in DEM system (nullptr if it is not selected or on 
+	/// processors other than the main processor)
+	inline
+	standInDEMSystem* standIn()
+	{
+		return dynamic_cast<standInDEMSystem*>(demSystem_.get());
 	}
 
 	inline
 	Timers* getTimers()
 	{
-		if(demSystem_)
-		{
-			return &demSystem_->Control().timers();
-		}
-		else
-		{
-			return nullptr;
-		}
+		if(!demSystem_) return nullptr;
+		return demSystem_->timers();
 	}
 
 };
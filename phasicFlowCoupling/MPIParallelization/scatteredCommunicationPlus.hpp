@@ -21,6 +21,11 @@ Licence:
 #ifndef __scatteredCommunicationPlus_hpp__ 
 #define __scatteredCommunicationPlus_hpp__
 
+// from std
+#include <array>
+#include <vector>
+#include <type_traits>
+
 #include "span.hpp"
 #include "procCommunicationPlus.hpp"
 #include "mpiCommunicationPlus.hpp"
@@ -31,9 +36,64 @@ Licence:
 namespace pFlow::Plus
 {
 
+/// Data type on the wire when compact (single precision) transfer is requested
+template<typename T>
+struct compactType
+{
+	using type = T;
+
+	static inline type pack(const T& val)
+	{
+		return val;
+	}
+
+	static inline T unpack(const type& val)
+	{
+		return val;
+	}
+};
+
+template<>
+struct compactType<real>
+{
+	using type = float;
+
+	static inline type pack(const real& val)
+	{
+		return static_cast<float>(val);
+	}
+
+	static inline real unpack(const type& val)
+	{
+		return static_cast<real>(val);
+	}
+};
+
+template<>
+struct compactType<realx3>
+{
+	using type = std::array<float,3>;
+
+	static inline type pack(const realx3& val)
+	{
+		return {
+			static_cast<float>(val.x()), 
+			static_cast<float>(val.y()), 
+			static_cast<float>(val.z())};
+	}
+
+	static inline realx3 unpack(const type& val)
+	{
+		return realx3(val[0], val[1], val[2]);
+	}
+};
+
 template<typename T>
 void performSum(span<T>& dest, T* src, span<const int32>& map);
 
+template<typename T, typename C>
+void performCompactSum(span<T>& dest, const C* src, span<const int32>& map);
+
 
 template<typename T>
 class scatteredCommunication
@@ -54,6 +114,137 @@ protected:
 
 	procVector<int32> 				sortedProcessors_ {0,true};
 
+	using CompactType = typename compactType<T>::type;
+
+	/// If T and its compact type are the same, compact transfer is ignored
+	static constexpr bool hasCompactType_ = !std::is_same_v<T, CompactType>;
+
+	/// Buffers for compact transfer on master (one per processor)
+	mutable procVector<std::vector<CompactType>> compactBuffers_ {true};
+
+	/// Buffer for compact transfer on this processor 
+	mutable std::vector<CompactType> 	localCompactBuffer_;
+
+	bool distributeCompact(span<T>& sendBuff, span<T>& recvb)const
+	{
+		procVector<Request> requests(true);
+		procVector<Status> statuses(true);
+
+		if(processor::isMaster())
+		{
+			bool res = true;
+			for(int32 i = dataMaps_.size()-1; i>=0; i--)
+			{
+				auto& buff = compactBuffers_[i];
+				const auto& map = dataMaps_[i];
+				buff.resize(map.size());
+				for(size_t j=0; j<map.size(); j++)
+				{
+					buff[j] = compactType<T>::pack(sendBuff[map[j]]);
+				}
+
+				res = res&&CheckMPI(
+					MPI_Issend( 
+						buff.data(), 
+						buff.size()*sFactor<CompactType>(), 
+						Type<CompactType>(), 
+						i, 
+						0, 
+						processor::worldCommunicator(),
+						&requests[i]), 
+					false);
+			}
+
+			if(!res)return false;
+		}
+
+		localCompactBuffer_.resize(recvb.size());
+
+		Status stat;
+		bool sucss = CheckMPI( 
+			MPI_Recv(
+				localCompactBuffer_.data(), 
+				localCompactBuffer_.size()*sFactor<CompactType>(), 
+				Type<CompactType>(), 
+				0, 
+				0, 
+				processor::worldCommunicator(),
+				&stat),
+			false);
+
+		for(size_t j=0; j<recvb.size(); j++)
+		{
+			recvb[j] = compactType<T>::unpack(localCompactBuffer_[j]);
+		}
+
+		if(processor::isMaster())
+		{
+			CheckMPI(
+				MPI_Waitall(requests.size(), requests.data(), statuses.data()),
+				false
+				);
+		}
+
+		return sucss;
+	}
+
+	bool collectSumCompact(span<T>& sendBuff, span<T>& recvb)
+	{
+		localCompactBuffer_.resize(sendBuff.size());
+		for(size_t j=0; j<sendBuff.size(); j++)
+		{
+			localCompactBuffer_[j] = compactType<T>::pack(sendBuff[j]);
+		}
+
+		Request sendRequest;
+		bool succs = CheckMPI(
+			MPI_Isend(
+				localCompactBuffer_.data(),
+				localCompactBuffer_.size()*sFactor<CompactType>(),
+				Type<CompactType>(),
+				0,
+				0,
+				processor::worldCommunicator(),
+				&sendRequest),
+			false);
+		if(!succs) return false;
+
+		if(processor::isMaster())
+		{
+			procVector<Request> requests(true);
+
+			for(size_t i=0; i<compactBuffers_.size(); i++)
+			{
+				compactBuffers_[i].resize(dataMaps_[i].size());
+				succs = succs&& CheckMPI(
+					MPI_Irecv(
+						compactBuffers_[i].data(),
+						compactBuffers_[i].size()*sFactor<CompactType>(),
+						Type<CompactType>(),
+						i,
+						0,
+						processor::worldCommunicator(),
+						&requests[i]
+						),
+					true);
+			}
+
+			if(!succs) return false;
+			Status stat;
+			size_t numFinished = 0;
+			int    procNo;
+			while (numFinished < requests.size())
+			{
+				MPI_Waitany(requests.size(), requests.data(), &procNo, &stat);
+				numFinished++;
+				performCompactSum(recvb, compactBuffers_[procNo].data(), dataMaps_[procNo]);
+			}
+		}
+
+		Status stat;
+		return CheckMPI(Wait(&sendRequest, &stat), false);
+	}
+
 	bool createIndexTypes()
 	{
 
@@ -160,8 +351,14 @@ public:
 		return true;
 	}
 
-	bool distribute(span<T>& sendBuff, span<T>& recvb)const
+	/// Distribute data on master to all processors based on data maps. 
+	/// If compact is true, data are sent in single precision.
+	bool distribute(span<T>& sendBuff, span<T>& recvb, bool compact = false)const
 	{
+		if constexpr (hasCompactType_)
+		{
+			if(compact) return distributeCompact(sendBuff, recvb);
+		}
 		
 		procVector<Request> requests(true);
 		procVector<Status> statuses(true);
@@ -209,8 +406,14 @@ public:
 		return sucss;
 	}
 
-	bool collectSum(span<T>& sendBuff, span<T>& recvb)
+	/// Collect data from all processors and sum them on master based on 
+	/// data maps. If compact is true, data are sent in single precision.
+	bool collectSum(span<T>& sendBuff, span<T>& recvb, bool compact = false)
 	{
+		if constexpr (hasCompactType_)
+		{
+			if(compact) return collectSumCompact(sendBuff, recvb);
+		}
 		
 		bool succs;
 	
@@ -274,6 +477,15 @@ void performSum(span<T>& dest, T* src, span<const int32>& map)
 	}
 }
 
+template<typename T, typename C>
+void performCompactSum(span<T>& dest, const C* src, span<const int32>& map)
+{
+	for(uint32 i=0; i<map.size(); i++)
+	{
+		dest[map[i]] += compactType<T>::unpack(src[i]); 
+	}
+}
+
 
 } //pFlow::Plus
 
@@ -0,0 +1,209 @@
+/*------------------------------- phasicFlow ---------------------------------
+      O        C enter of
+     O O       E ngineering and
+    O   O      M ultiscale modeling of
+   OOOOOOO     F luid flow
+------------------------------------------------------------------------------
+  Copyright (C): www.cemf.ir
+  email: hamid.r.norouzi AT gmail.com
+------------------------------------------------------------------------------
+Licence:
+  This file is part of phasicFlow code. It is a free software for simulating
+  granular and multiphase flows. You can redistribute it and/or modify it under
+  the terms of GNU General Public License v3 or any other later versions.
+
+  phasicFlow is distributed to help others in their research in the field of
+  granular and multiphase flows, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+-----------------------------------------------------------------------------*/
+
+/**
+ * @class standInDEMSystem
+ * @brief A stand-in for the DEM system with synthetic particles.
+ *
+ * It implements DEMSystemInterface and provides the same data to
+ * procDEMSystem as a phasicFlow DEMSystem (positions, velocities,
+ * diameters and particle indices in processor domains), but particles are set by the user and move ballistically
+ * inside a box (reflected at its walls). It is selected with
+ * `DEMSystem standInDEMSystem;` in couplingProperties and is meant for
+ * benchmarking the coupling layer without a DEM case.
+ */
+
+#ifndef __standInDEMSystemPlus_hpp__
+#define __standInDEMSystemPlus_hpp__
+
+// from std
+#include <vector>
+
+// from phasicFlow
+#include "types.hpp"
+#include "typeInfo.hpp"
+#include "span.hpp"
+#include "box.hpp"
+
+// from coupling-phasicFlow
+#include "DEMSystemInterfacePlus.hpp"
+
+namespace pFlow::Plus
+{
+
+class standInDEMSystem
+:
+	public DEMSystemInterface
+{
+private:
+
+	std::vector<realx3> 	position_;
+
+	std::vector<realx3> 	velocity_;
+
+	std::vector<realx3> 	rVelocity_;
+
+	std::vector<real> 		diameter_;
+
+	std::vector<real> 		courseGrainFactor_;
+
+	std::vector<uint32> 	particleId_;
+
+	std::vector<realx3> 	fluidForce_;
+
+	std::vector<realx3> 	fluidTorque_;
+
+	/// Particle indices in each processor domain
+	std::vector<std::vector<int32>> 	parIndexInDomains_;
+
+	/// Particles are reflected at the walls of this box
+	box 					domain_;
+
+	/// Current time
+	real 					time_ = 0;
+
+public:
+
+	TypeInfoNV("standInDEMSystem");
+
+	standInDEMSystem() = default;
+
+	/// Set particles (position, diameter, velocity) and the box which
+	/// contains them. All other fields are reset.
+	void setParticles(
+		std::vector<realx3>&& 	position,
+		std::vector<real>&& 	diameter,
+		std::vector<realx3>&& 	velocity,
+		const box& 				domain);
+
+	inline
+	bool beforeIteration() override
+	{
+		return true;
+	}
+
+	/// Find particles in the domains, extended by extentFraction times
+	/// the largest particle diameter
+	bool updateParticleDistribution(
+		real extentFraction,
+		const std::vector<box>& domains) override;
+
+	inline
+	std::vector<int32> numParInDomains()const override
+	{
+		std::vector<int32> numPar(parIndexInDomains_.size());
+		for(size_t i=0; i<numPar.size(); i++)
+		{
+			numPar[i] = static_cast<int32>(parIndexInDomains_[i].size());
+		}
+		return numPar;
+	}
+
+	inline
+	span<const int32> parIndexInDomain(int32 di)const override
+	{
+		if( di >= static_cast<int32>(parIndexInDomains_.size()) )
+			return span<const int32>();
+
+		return span<const int32>(
+			parIndexInDomains_[di].data(),
+			parIndexInDomains_[di].size());
+	}
+
+	inline
+	span<uint32> particleId() override
+	{
+		return span<uint32>(particleId_.data(), particleId_.size());
+	}
+
+	inline
+	span<realx3> position() override
+	{
+		return span<realx3>(position_.data(), position_.size());
+	}
+
+	inline
+	span<realx3> velocity() override
+	{
+		return span<realx3>(velocity_.data(), velocity_.size());
+	}
+
+	inline
+	span<realx3> rVelocity() override
+	{
+		return span<realx3>(rVelocity_.data(), rVelocity_.size());
+	}
+
+	inline
+	span<realx3> parFluidForce() override
+	{
+		return span<realx3>(fluidForce_.data(), fluidForce_.size());
+	}
+
+	inline
+	span<realx3> parFluidTorque() override
+	{
+		return span<realx3>(fluidTorque_.data(), fluidTorque_.size());
+	}
+
+	inline
+	span<real> diameter() override
+	{
+		return span<real>(diameter_.data(), diameter_.size());
+	}
+
+	inline
+	span<real> courseGrainFactor() override
+	{
+		return span<real>(courseGrainFactor_.data(), courseGrainFactor_.size());
+	}
+
+	inline
+	bool sendFluidForceToDEM() override
+	{
+		return true;
+	}
+
+	inline
+	bool sendFluidTorqueToDEM() override
+	{
+		return true;
+	}
+
+	/// Move particles with their velocities up to time upToTime
+	bool iterate(real upToTime);
+
+	/// Same as iterate(upToTime), the stand-in has nothing to write
+	inline
+	bool iterate(real upToTime, bool, const word&) override
+	{
+		return iterate(upToTime);
+	}
+
+	inline
+	real startTime()const override
+	{
+		return 0;
+	}
+};
+
+} // pFlow::Plus
+
+#endif //__standInDEMSystemPlus_hpp__
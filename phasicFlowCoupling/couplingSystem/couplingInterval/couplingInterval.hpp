@@ -0,0 +1,136 @@
+/*------------------------------- phasicFlow ---------------------------------
+      O        C enter of
+     O O       E ngineering and
+    O   O      M ultiscale modeling of
+   OOOOOOO     F luid flow
+------------------------------------------------------------------------------
+  Copyright (C): www.cemf.ir
+  email: hamid.r.norouzi AT gmail.com
+------------------------------------------------------------------------------
+Licence:
+  This file is part of phasicFlow code. It is a free software for simulating
+  granular and multiphase flows. You can redistribute it and/or modify it under
+  the terms of GNU General Public License v3 or any other later versions.
+
+  phasicFlow is distributed to help others in their research in the field of
+  granular and multiphase flows, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+-----------------------------------------------------------------------------*/
+
+/**
+ * @class couplingInterval
+ * @brief Number of fluid time steps between two coupling exchanges.
+ *
+ * By default, data are exchanged between CFD and DEM in every fluid time 
+ * step. With couplingInterval N, particle data are obtained from DEM, 
+ * coupling terms are calculated and fluid forces are sent to DEM only in 
+ * every Nth fluid time step (and in write time steps, so that CFD and DEM 
+ * are written at the same state). In between, the fluid uses the coupling 
+ * terms of the last exchange (hold) and DEM is not advanced. In the next 
+ * exchange, DEM is iterated over the whole interval with the fluid forces 
+ * of the last exchange. 
+ * 
+ * The change of the fluid volume fraction in an exchange is spread over 
+ * the fluid time steps of the interval, so that its time derivative in 
+ * continuity does not jump N-fold in exchange steps (and vanish in 
+ * between): alpha of unresolved coupling is interpolated between the last 
+ * two exchanges and ddt(voidFraction) of resolved coupling is the change 
+ * of the last exchange over N fluid time steps. 
+ *
+ * Set in couplingProperties: 
+ * @code
+ * couplingInterval   5;    // default: 1
+ * @endcode
+ * The number of skipped exchanges and an estimate of the coupling time 
+ * saved (mean wall time of an exchange times skipped exchanges) are 
+ * reported in each exchange. 
+ */
+
+#ifndef __couplingInterval_hpp__
+#define __couplingInterval_hpp__
+
+#include <chrono>
+
+// from OpenFOAM
+#include "OFCompatibleHeader.hpp"
+
+
+namespace pFlow::coupling
+{
+
+class couplingInterval
+{
+private:
+
+	using clock = std::chrono::steady_clock;
+
+	/// Number of fluid time steps between two exchanges
+	Foam::label 			interval_;
+
+	/// Number of fluid time steps since the last exchange
+	Foam::label 			numSteps_;
+
+	/// Number of exchanges performed so far
+	Foam::label 			numExchanges_ = 0;
+
+	/// Number of exchanges skipped so far
+	Foam::label 			numSkipped_ = 0;
+
+	/// Wall time of all timed exchanges (s)
+	double 					exchangeTime_ = 0;
+
+	/// Start of the current timed part of an exchange
+	clock::time_point 		start_;
+
+public:
+
+	/// Construct from couplingProperties
+	explicit couplingInterval(const Foam::dictionary& dict);
+
+	couplingInterval(const couplingInterval&)=delete;
+
+	couplingInterval& operator = (const couplingInterval&)=delete;
+
+	~couplingInterval()=default;
+
+	inline 
+	Foam::label interval()const
+	{
+		return interval_;
+	}
+
+	/// Number of fluid time steps since the last exchange 
+	/// (0 in an exchange step)
+	inline 
+	Foam::label stepInInterval()const
+	{
+		return numSteps_;
+	}
+
+	/// Should data be exchanged in this fluid time step? 
+	/// Call once per fluid time step. 
+	bool exchangeStep(bool writeTime);
+
+	/// Begin timing of (a part of) the exchange in this time step
+	inline
+	void begin()
+	{
+		start_ = clock::now();
+	}
+
+	/// End timing of (a part of) the exchange in this time step
+	inline
+	void end()
+	{
+		exchangeTime_ += std::chrono::duration<double>(clock::now() - start_).count();
+	}
+
+	/// Estimated coupling time saved by skipped exchanges (s)
+	double savedTime()const;
+
+};
+
+} // pFlow::coupling
+
+#endif //__couplingInterval_hpp__
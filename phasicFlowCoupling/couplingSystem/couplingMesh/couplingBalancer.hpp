@@ -0,0 +1,140 @@
+/*------------------------------- phasicFlow ---------------------------------
+      O        C enter of
+     O O       E ngineering and
+    O   O      M ultiscale modeling of
+   OOOOOOO     F luid flow
+------------------------------------------------------------------------------
+  Copyright (C): www.cemf.ir
+  email: hamid.r.norouzi AT gmail.com
+------------------------------------------------------------------------------
+Licence:
+  This file is part of phasicFlow code. It is a free software for simulating
+  granular and multiphase flows. You can redistribute it and/or modify it under
+  the terms of GNU General Public License v3 or any other later versions.
+
+  phasicFlow is distributed to help others in their research in the field of
+  granular and multiphase flows, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+-----------------------------------------------------------------------------*/
+
+/**
+ * @class couplingBalancer
+ * @brief Run-time redistribution of the fluid mesh based on coupling cost.
+ *
+ * The cost of a processor in a coupling step is roughly proportional to the 
+ * number of particles located in its mesh. When particles accumulate in a 
+ * part of the domain (e.g. a settling bed), the static decomposition of the 
+ * fluid mesh leads to a large load imbalance (max/mean of particles over 
+ * processors, see couplingMesh::loadImbalance()). 
+ *
+ * Every checkInterval coupling steps, the imbalance of the last step is 
+ * checked and, if it exceeds threshold, the mesh is decomposed again with 
+ * cell weights 1 + particleCost*(number of particles in cell) and is 
+ * redistributed over processors with fvMeshDistribute. All registered 
+ * fields are mapped by fvMeshDistribute. The coupling state that depends on 
+ * local cell indices (particle cell indices, search tree, neighbor lists, 
+ * solid volumes) is rebuilt by the coupling system afterwards. 
+ *
+ * Rebalancing is inactive by default and is activated in couplingProperties:
+ * @code
+ * rebalance
+ * {
+ *     active         yes;       // default: no
+ *     threshold      1.3;       // imbalance (max/mean) that triggers rebalancing
+ *     checkInterval  10;        // coupling steps between two checks
+ *     particleCost   1;         // cost of a particle relative to a cell
+ *     method         ptscotch;  // parallel decomposition method
+ * }
+ * @endcode
+ * Other entries (e.g. coefficients of the method) are passed to the 
+ * decomposition method. 
+ *
+ * The reference cell of pressure (pRefCell of the solvers) is a local cell 
+ * index, which is not valid after redistribution. Rebalancing is therefore 
+ * refused (and deactivated) when p or p_rgh needs a reference level, i.e. 
+ * the domain has no fixed pressure boundary. 
+ */
+
+#ifndef __couplingBalancer_hpp__
+#define __couplingBalancer_hpp__
+
+// from OpenFOAM
+#include "OFCompatibleHeader.hpp"
+
+// from phasicFlow-coupling
+#include "couplingMesh.hpp"
+
+
+namespace pFlow::coupling
+{
+
+class couplingBalancer
+{
+private:
+
+	/// Reference to fvMesh (redistributed in place)
+	Foam::fvMesh& 			mesh_;
+
+	/// Dictionary of the decomposition method
+	Foam::dictionary 		decompDict_;
+
+	/// Is rebalancing active? 
+	Foam::Switch 			active_;
+
+	/// Load imbalance (max/mean) that triggers rebalancing
+	Foam::scalar 			threshold_;
+
+	/// Number of coupling steps between two checks
+	Foam::label 			checkInterval_;
+
+	/// Cost of one particle relative to one fluid cell
+	Foam::scalar 			particleCost_;
+
+	/// Number of coupling steps since the last check
+	Foam::label 			numSteps_ = 0;
+
+	/// Number of redistributions performed so far 
+	Foam::label 			numRebalances_ = 0;
+
+	/// Cell weights for decomposition from particles located in cells 
+	Foam::scalarField cellWeights(const couplingMesh& cMesh)const;
+
+	/// If p or p_rgh needs a reference level (collective call)
+	bool pressureNeedsReference()const;
+
+public:
+
+	/// Construct from rebalance dictionary
+	couplingBalancer(
+		const Foam::dictionary& dict,
+		Foam::fvMesh& mesh);
+
+	couplingBalancer(const couplingBalancer&)=delete;
+
+	couplingBalancer& operator = (const couplingBalancer&)=delete;
+
+	~couplingBalancer()=default;
+
+	inline 
+	bool active()const
+	{
+		return active_;
+	}
+
+	inline
+	Foam::label numRebalances()const
+	{
+		return numRebalances_;
+	}
+
+	/// Check the load imbalance of the last coupling step and redistribute 
+	/// the mesh if required (collective call). 
+	/// Returns true if the mesh has been redistributed. 
+	bool checkAndRebalance(const couplingMesh& cMesh);
+
+};
+
+} // pFlow::coupling
+
+#endif //__couplingBalancer_hpp__
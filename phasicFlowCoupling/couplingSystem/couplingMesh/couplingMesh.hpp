@@ -25,6 +25,7 @@ Licence:
 #include "OFCompatibleHeader.hpp"
 #include "indexedOctree.H"
 #include "treeDataCell.H"
+#include "uniformDimensionedFields.H"
 
 
 
@@ -32,6 +33,9 @@ Licence:
 #include "procCMField.hpp"
 #include "box.hpp"
 
+// phasicFlow-coupling
+#include "couplingProfiler.hpp"
+
 
 namespace pFlow::coupling
 {
@@ -64,6 +68,22 @@ private:
 		/// cell decomposition mode
 		Foam::polyMesh::cellDecomposition 		cellDecompositionMode_;
 
+		/// Profiler for counting cell searches
+		couplingProfiler& 	profiler_;
+
+		/// Number of particles in each cell (optional, particleCount yes;)
+		uniquePtr<Foam::volScalarField> 	particleCount_ = nullptr;
+
+		/// Time-averaged number of particles in each cell 
+		uniquePtr<Foam::volScalarField> 	particleCountMean_ = nullptr;
+
+		/// Number of coupling steps in particleCountMean_, written to 
+		/// <time>/uniform to continue the average on restart
+		uniquePtr<Foam::uniformDimensionedScalarField> numCountSamples_ = nullptr;
+
+		/// Load imbalance of particles over processors (max/mean)
+		mutable real 		loadImbalance_ = 1;
+
 	// - member functions
 
 		/// Calculate the actual bounding box mesh based on points
@@ -74,6 +94,9 @@ private:
 
 		void mapParticles();
 
+		/// Update particle count in cells and its time average
+		void updateParticleCount();
+
 public:
 
 	// - Constructors
@@ -81,7 +104,8 @@ public:
 		couplingMesh(
 			const Foam::dictionary& dict,
 			Foam::fvMesh& mesh,
-			const Plus::centerMassField& centerMass
+			const Plus::centerMassField& centerMass,
+			couplingProfiler& profiler
 			);
 
 		couplingMesh(const couplingMesh&)=delete;
@@ -104,6 +128,13 @@ public:
 			return mesh_;
 		}
 
+		/// Profiler of coupling steps (for hot-path counters)
+		inline
+		couplingProfiler& profiler()const
+		{
+			return profiler_;
+		}
+
 		/// Return cosnt ref to mesh box
 		inline
 		const auto& meshBox()const
@@ -111,6 +142,22 @@ public:
 			return meshBox_;
 		}
 		
+		/// Does a sphere intersect the mesh box of this processor? 
+		/// Particles that do not, cannot overlap any cell of this processor.
+		inline
+		bool sphereInMeshBox(const Foam::point& centre, Foam::scalar radius)const
+		{
+			const auto& minP = meshBox_.minPoint();
+			const auto& maxP = meshBox_.maxPoint();
+			const Foam::point nearest
+			(
+				Foam::min(Foam::max(centre.x(), minP.x()), maxP.x()),
+				Foam::min(Foam::max(centre.y(), minP.y()), maxP.y()),
+				Foam::min(Foam::max(centre.z(), minP.z()), maxP.z())
+			);
+			return Foam::magSqr(nearest - centre) <= radius*radius;
+		}
+
 		/// Is mesh dynamic?
 		inline 
 		auto dynamic()const
@@ -144,6 +191,10 @@ public:
         /// and after mesh motion (if any).
         void update();
 
+		/// Rebuild mesh-dependent data after the mesh is redistributed 
+		/// among processors (box, search tree and cell indices of particles)
+		void meshRedistributed();
+
         /// cell index of each particle center 
         inline
 		const Plus::procCMField<Foam::label>& parCellIndex()const
@@ -163,8 +214,23 @@ public:
         }
 
         /// Report (output) number of center mass points found in all processors 
-		/// It is effective only in master processor 
+		/// and update the load imbalance (collective call, output on master)
 		void reportNumInMesh()const;
+
+		/// Load imbalance of particles over processors in the last update 
+		/// (max/mean of particles located in processor meshes)
+		inline 
+		real loadImbalance()const
+		{
+			return loadImbalance_;
+		}
+
+		/// Number of particles in each cell (nullptr if not active)
+		inline
+		const Foam::volScalarField* particleCount()const
+		{
+			return particleCount_.get();
+		}
 		
         /// check if a point is located in a specific cell
 		bool pointInCell(
@@ -190,6 +256,15 @@ public:
 			const Foam::point& p, 
 			Foam::label cellId)const;
 
+		/// Find the cell containing p, starting from cellId and its 
+		/// face neighbors before searching the octree (for points 
+		/// that are close to each other, e.g. on a particle surface). 
+		/// mesh().cellCells() should be constructed before calling 
+		/// this function in a parallel region. 
+		Foam::label findPointNearCell(
+			const Foam::point& p, 
+			Foam::label cellId)const;
+
 		Foam::label findPointSphereInCellTree(
 			const Foam::point& p,
 			Foam::scalar rad,
@@ -246,6 +321,12 @@ public:
 
 
 		Foam::labelList findSphere(Foam::label cellId, Foam::scalar radius)const;
+
+		/// Cells whose bounding boxes overlap the box
+		Foam::labelList findBox(const Foam::treeBoundBox& bb)const;
+
+		/// Cells whose bounding boxes overlap the bounding box of a sphere 
+		Foam::labelList findSphere(const Foam::point& centre, Foam::scalar radius)const;
 		
 
 };
@@ -68,6 +68,13 @@ class particleMapping
     /// If everything is constructed for the first time
     bool                firstConstructed_ = false;
 
+    /// If particle maps were changed in the last call to update
+    bool                mapsChanged_ = false;
+
+    /// Particle fields that are transferred in single precision 
+    /// (e.g. velocity, fluidForce). Empty means full precision for all.
+    Foam::wordList      singlePrecisionFields_;
+
 
 public:
 
@@ -90,12 +97,35 @@ public:
         Foam::scalar fluidDt
     )const;
 
+    /// Force re-mapping of particles to processors in the next update 
+    /// (e.g. after the mesh is redistributed)
+    inline
+    void forceDomainUpdate()
+    {
+        firstConstructed_ = false;
+    }
+
     bool update(
         Foam::scalar t,
         Foam::scalar fluidDt,
         Plus::procDEMSystem& pDEMSystem,
         const couplingMesh& cMesh);
 
+    /// Check if particles are re-mapped to processors in the last update. 
+    /// Particle indices on this processor are only valid between two re-maps.
+    inline
+    bool mapsChanged()const
+    {
+        return mapsChanged_;
+    }
+
+    /// Check if particle field fieldName is transferred in single precision
+    inline
+    bool compactTransfer(const Foam::word& fieldName)const
+    {
+        return singlePrecisionFields_.found(fieldName);
+    }
+
     inline
     Plus::centerMassField& centerMass()
     {
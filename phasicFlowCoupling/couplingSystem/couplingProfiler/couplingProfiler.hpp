@@ -0,0 +1,258 @@
+/*------------------------------- phasicFlow ---------------------------------
+      O        C enter of
+     O O       E ngineering and
+    O   O      M ultiscale modeling of
+   OOOOOOO     F luid flow
+------------------------------------------------------------------------------
+  Copyright (C): www.cemf.ir
+  email: hamid.r.norouzi AT gmail.com
+------------------------------------------------------------------------------
+Licence:
+  This file is part of phasicFlow code. It is a free software for simulating
+  granular and multiphase flows. You can redistribute it and/or modify it under
+  the terms of GNU General Public License v3 or any other later versions.
+
+  phasicFlow is distributed to help others in their research in the field of
+  granular and multiphase flows, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+-----------------------------------------------------------------------------*/
+
+/**
+ * @class couplingProfiler
+ * @brief Per-phase timing of coupling steps with machine-readable output.
+ *
+ * The time spent in each phase of a coupling step (remap, locate, weights,
+ * porosity, drag, lift, smoothing, scatter and gather) is recorded on every
+ * processor. At the start of the next coupling step (or by flush() at the
+ * end of the run), min, max and mean over processors are written by master to
+ * postProcessing/couplingProfiler/<startTime>/couplingProfile.csv (or .json,
+ * one JSON object per line). A large max/mean ratio shows load imbalance.
+ * The values of each processor are written to couplingProfileProcessors.csv
+ * (or .json), one line per processor and coupling step, to find which
+ * processor is slow in which phase.
+ *
+ * Phases may be nested. The time of a nested phase is not counted for the
+ * enclosing phase (e.g. smoothing inside drag).
+ *
+ * Counters of hot-path events (cell searches, octree searches, particles 
+ * outside the mesh, distribution weights and the branches taken by 
+ * subDivision29 methods) are also accumulated per coupling step in 
+ * thread-local slots and written next to the phase timings.
+ *
+ * Profiling is inactive by default and is activated in couplingProperties:
+ * @code
+ * profiling
+ * {
+ *     active    yes;    // default: no
+ *     format    csv;    // csv (default) or json
+ *     perProcessor yes; // default: yes
+ * }
+ * @endcode
+ */
+
+#ifndef __couplingProfiler_hpp__
+#define __couplingProfiler_hpp__
+
+// from std
+#include <array>
+#include <algorithm>
+#include <vector>
+#include <chrono>
+#include <omp.h>
+
+// from OpenFOAM
+#include "OFCompatibleHeader.hpp"
+#include "OFstream.H"
+
+// from phasicFlow
+#include "typeInfo.hpp"
+#include "uniquePtr.hpp"
+
+
+namespace pFlow::coupling
+{
+
+class couplingProfiler
+{
+public:
+
+	/// Phases of a coupling step
+	enum phase: unsigned
+	{
+		remap = 0,
+		locate,
+		weights,
+		porosity,
+		drag,
+		lift,
+		smoothing,
+		scatter,
+		gather,
+		numPhases
+	};
+
+	/// Counters of hot-path events in a coupling step
+	enum counter: unsigned
+	{
+		cellSearches = 0, 	// calls to point-in-cell search
+		octreeSearches, 	// searches that fall through to octree findInside
+		outsideMesh, 		// particles not located in this processor mesh
+		particles, 			// particles in this processor
+		particleWeights, 	// distribution weights of all particles
+		subDivFull, 		// subDivision29: sphere fully inside the center cell
+		subDivHalf, 		// subDivision29: inner shell inside the center cell
+		subDivOutside, 		// subDivision29: all sub-points are located
+		culledParticles, 	// resolved: particles not reaching this processor mesh box
+		numCounters
+	};
+
+private:
+
+	using clock = std::chrono::steady_clock;
+
+	/// Counters of one thread (padded to avoid false sharing)
+	struct alignas(64) threadCounters
+	{
+		std::array<uint64, numCounters> counts{};
+	};
+
+	/// Names of phases in output files
+	static const std::array<Foam::word, numPhases> phaseNames_;
+
+	/// Names of counters in output files
+	static const std::array<Foam::word, numCounters> counterNames_;
+
+	const Foam::Time& 					time_;
+
+	/// Is profiling active
+	bool 								active_;
+
+	/// Output in json format (csv otherwise)
+	bool 								json_;
+
+	/// Write the values of each processor too
+	bool 								perProcessor_;
+
+	/// Time of the current coupling step
+	Foam::scalar 						stepTime_ = 0;
+
+	/// If any phase is recorded in the current coupling step
+	bool 								stepRecorded_ = false;
+
+	/// Accumulated duration (s) of each phase in the current coupling step
+	std::array<double, numPhases> 		durations_{};
+
+	/// Counters of the current coupling step, one slot per thread
+	std::vector<threadCounters> 		threadCounts_;
+
+	/// Running phases and the time they were (re)started
+	std::vector<std::pair<phase, clock::time_point>> 	running_;
+
+	/// Output file (only on master)
+	uniquePtr<Foam::OFstream> 			os_ = nullptr;
+
+	/// Output file of values of each processor (only on master)
+	uniquePtr<Foam::OFstream> 			procOs_ = nullptr;
+
+	void openFiles();
+
+	/// Gather durations and counters of processors and write them (on master)
+	void write();
+
+public:
+
+	TypeInfoNV("couplingProfiler");
+
+	couplingProfiler(const Foam::Time& time, const Foam::dictionary& dict);
+
+	couplingProfiler(const couplingProfiler&) = delete;
+
+	couplingProfiler& operator=(const couplingProfiler&) = delete;
+
+	/// Only closes the files, the last coupling step is written by flush()
+	~couplingProfiler() = default;
+
+	inline
+	bool active()const
+	{
+		return active_;
+	}
+
+	/// Write the previous coupling step and start recording a new one at t
+	/// (collective call)
+	void beginStep(Foam::scalar t);
+
+	/// Write the current coupling step if it is not written yet 
+	/// (collective call, all processors must call it before MPI is finalized,
+	/// the destructor does not call it)
+	void flush();
+
+	/// Start recording phase p
+	void start(phase p);
+
+	/// End recording phase p (the last started phase)
+	void end(phase p);
+
+	/// Duration (s) of phase p recorded so far in the current coupling step
+	inline
+	double duration(phase p)const
+	{
+		return durations_[p];
+	}
+
+	/// Name of phase p
+	static
+	const Foam::word& phaseName(phase p)
+	{
+		return phaseNames_[p];
+	}
+
+	/// Add n to counter c (thread-safe, can be called in OpenMP regions)
+	inline
+	void count(counter c, uint64 n = 1)
+	{
+		if(!active_) return;
+
+		const auto thread = static_cast<size_t>(omp_get_thread_num());
+		if(thread < threadCounts_.size())
+		{
+			threadCounts_[thread].counts[c] += n;
+		}
+	}
+
+};
+
+
+/// Record a phase from construction to destruction of the scope
+class profilerScope
+{
+private:
+
+	couplingProfiler& 			profiler_;
+
+	couplingProfiler::phase 	phase_;
+
+public:
+
+	profilerScope(couplingProfiler& profiler, couplingProfiler::phase p)
+	:
+		profiler_(profiler),
+		phase_(p)
+	{
+		profiler_.start(phase_);
+	}
+
+	profilerScope(const profilerScope&) = delete;
+
+	profilerScope& operator=(const profilerScope&) = delete;
+
+	~profilerScope()
+	{
+		profiler_.end(phase_);
+	}
+};
+
+} // pFlow::coupling
+
+#endif //__couplingProfiler_hpp__
@@ -32,7 +32,10 @@ Licence:
 #include "procCMFields.hpp"
 #include "procDEMSystemPlus.hpp"
 #include "couplingMesh.hpp"
+#include "couplingBalancer.hpp"
+#include "couplingInterval.hpp"
 #include "Timers.hpp"
+#include "couplingProfiler.hpp"
 
 namespace pFlow::coupling
 {
@@ -46,8 +49,14 @@ private:
 	
 	particleMapping 			particleMapping_;
 
+	mutable couplingProfiler 	profiler_;
+
 	couplingMesh 				couplingMesh_;
 
+	couplingBalancer 			balancer_;
+
+	couplingInterval 			interval_;
+
 	Plus::procDEMSystem 		procDEMSystem_;
 
 	mutable Timers 				couplingTimers_;
@@ -72,6 +81,21 @@ private:
 
 	bool requireRVel_;
 
+	/// Number of particles in DEM at the last scatter of static fields
+	uint32 						numDEMParticles_ = 0;
+
+	/// Checksum of particle IDs in DEM at the last scatter of static fields
+	uint64 						particleIdChecksum_ = 0;
+
+	/// If static particle fields should be scattered in this coupling step
+	bool 						staticFieldsChanged_ = true;
+
+	/// Static particle fields (diameter, course grain factor, ...) do not 
+	/// change between two re-maps, unless particles are inserted/deleted in DEM. 
+	/// Insertions/deletions are detected by the number of particles and a 
+	/// checksum of particle IDs (computed on master)
+	bool checkForStaticFieldsUpdate();
+
 	bool collectFluidForce();
 
 	bool collectFluidTorque();
@@ -80,9 +104,25 @@ private:
 
 protected:
 
+	/// Scatter particle fields from master to processors. 
+	/// Dynamic fields (velocity, ...) are scattered in every coupling step and 
+	/// static fields (diameter, ...) only when staticFieldsChanged() is true. 
 	virtual
 	bool distributeParticleFields();
 
+	/// Rebuild the coupling state that depends on local cell indices, 
+	/// after the fluid mesh is redistributed among processors 
+	virtual 
+	void meshRedistributed()
+	{}
+
+	/// If static particle fields should be scattered in this coupling step
+	inline
+	bool staticFieldsChanged()const
+	{
+		return staticFieldsChanged_;
+	}
+
 	inline
 	Plus::procDEMSystem& pDEMSystem()
 	{
@@ -249,6 +289,26 @@ public:
 		return couplingTimers_;
 	}
 
+	/// Fluid time steps between two coupling exchanges
+	inline
+	couplingInterval& interval()
+	{
+		return interval_;
+	}
+
+	inline
+	const couplingInterval& interval()const
+	{
+		return interval_;
+	}
+
+	/// Per-phase profiler of coupling steps
+	inline
+	couplingProfiler& profiler()const
+	{
+		return profiler_;
+	}
+
 }; 
 
 } // pFlow::coupling
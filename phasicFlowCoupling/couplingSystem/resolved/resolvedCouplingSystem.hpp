@@ -27,8 +27,10 @@ Licence:
 #include "triSurface.H"
 #include "triSurfaceSearch.H"
 #include "fvCFD.H"
+#include "fvMeshSubset.H"
 
 #include "couplingSystem.hpp"
+#include "sphereSurfaceQuadrature.hpp"
 #include "virtualConstructor.hpp"
 
 
@@ -43,6 +45,60 @@ class resolvedCouplingSystem
 private:
 	Foam::volScalarField IBDiv_;
 
+	/// Calculate solid fraction of cells cut by sphere surfaces 
+	Foam::Switch 		partialVoidFraction_;
+
+	/// Number of sub-cell divisions in each direction for partial cells
+	Foam::label 		subCellDivisions_;
+
+	/// Surface quadrature of unit sphere for integration of fluid forces
+	sphereSurfaceQuadrature 	sphereQuadrature_;
+
+	/// Cells occupied by each particle and their solid fractions 
+	/// (reused between steps)
+	std::vector<std::vector<std::pair<Foam::label, Foam::scalar>>> solidCells_;
+
+	/// Restrict IBM correction to cells near particles 
+	Foam::Switch 		IBMNarrowBand_;
+
+	/// Number of cell layers around solid cells in the narrow band
+	Foam::label 		IBMBandLayers_;
+
+	/// Cells with voidFraction < 1 and their halo (narrow band)
+	Foam::labelList 	IBMBandCells_;
+
+	/// Sub-mesh of the narrow band, IBDiv is solved on it and is zero 
+	/// outside the band (on the faces exposed by the subset)
+	uniquePtr<Foam::fvMeshSubset> IBMSubset_;
+
+	/// voidFraction before the last exchange (couplingInterval > 1)
+	Foam::scalarField 	voidFraction0_;
+
+	/// Solid fraction of cell celli occupied by a sphere.
+	/// Cells with all points inside the sphere are solid, cells cut by the 
+	/// sphere surface are sampled on subCellDivisions^3 points of their 
+	/// bounding box. 
+	Foam::scalar sphereSolidFraction
+	(
+		Foam::label celli,
+		const Foam::point& centre,
+		Foam::scalar radius
+	)const;
+
+	/// Set voidFraction, particleID and Us in solidCells_ of particles
+	void setSolidCells
+	(
+		pFlow::uniquePtr<Foam::volScalarField>& particleIDPtr,
+		Foam::volVectorField& Us
+	);
+
+	/// Update cells (and sub-mesh) of the narrow band from voidFraction. 
+	/// The band grows across processor (and cyclic) patches. 
+	void updateIBMBand();
+
+	/// Solve IBDiv on the sub-mesh of the narrow band for source
+	void solveIBDivInBand(const Foam::volScalarField& source);
+
 protected:
 
 	Foam::volScalarField voidFraction_;
@@ -84,6 +140,12 @@ public:
 		return voidFraction_;
 	}
 
+	/// Rate of change of voidFraction for continuity. With couplingInterval 
+	/// N > 1, particles only move in exchanges and the change of the last 
+	/// exchange is spread over N fluid time steps (instead of ddt being 
+	/// N times larger in the exchange step and zero in between).
+	Foam::tmp<Foam::volScalarField> ddtVoidFraction()const;
+
 	/// Access to fluid torque
 	inline 
 	Plus::realx3ProcCMField& fluidTorque()
@@ -98,7 +160,20 @@ public:
 		return couplingSystem::fluidForce();
 	}
 
-	/// Calculating the solid-fluid interaction
+	/// Calculating the solid-fluid interaction for spheres. 
+	/// Cells are found analytically (|x-c| < r) among the cells 
+	/// overlapping the bounding box of each particle. With 
+	/// partialVoidFraction, cells cut by the particle surface get a 
+	/// voidFraction between 0 and 1. Particles that do not reach the 
+	/// mesh box of this processor are skipped. 
+	void calculateSolidInteraction
+	(
+		pFlow::uniquePtr<Foam::volScalarField>& particleIDPtr,
+		Foam::volVectorField& Us
+	);
+
+	/// Calculating the solid-fluid interaction for particles of 
+	/// general shape given by their STLs 
 	void calculateSolidInteraction
 	(
 		const Foam::PtrList<Foam::triSurface>& particleSTLs,
@@ -106,7 +181,19 @@ public:
 		Foam::volVectorField& Us
 	);
 
-	/// Calculating the fluid-solid interaction
+	/// Calculating the fluid-solid interaction for spheres. 
+	/// Pressure and viscous forces are integrated on the unit sphere 
+	/// quadrature scaled and translated to each particle. Particles 
+	/// that do not reach the mesh box of this processor get zero force 
+	/// and torque, which are then summed over processors. 
+	void calculateFluidInteraction
+	(
+		const Foam::volScalarField& p,	
+		const Foam::volSymmTensorField& devRhoReff
+	);
+
+	/// Calculating the fluid-solid interaction for particles of 
+	/// general shape given by their STLs
 	void calculateFluidInteraction
 	(
 		const Foam::volScalarField& p,	
@@ -114,14 +201,18 @@ public:
 		const Foam::PtrList<Foam::triSurface>& particleSTLs
 	);
 
-	/// Updating the pressure and velocity using Fictitious domain IBM
+	/// Updating the pressure and velocity using Fictitious domain IBM. 
+	/// IBDiv starts from its value in the previous step and is solved 
+	/// with the controls of IBDiv in fvSolution. With IBMNarrowBand, the 
+	/// velocity is blended in the narrow band only and IBDiv is fixed 
+	/// to zero outside of it. 
 	void IBMCorrect
 	(
 		Foam::volScalarField& p,
 		Foam::volVectorField& U,
-		const Foam::volScalarField rho,
-		const Foam::volVectorField Us,
-		const Foam::dictionary pDict
+		const Foam::volScalarField& rho,
+		const Foam::volVectorField& Us,
+		const Foam::dictionary& pDict
 	);
 }; 
 
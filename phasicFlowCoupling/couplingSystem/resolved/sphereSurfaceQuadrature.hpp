@@ -0,0 +1,87 @@
+/*------------------------------- phasicFlow ---------------------------------
+      O        C enter of
+     O O       E ngineering and
+    O   O      M ultiscale modeling of
+   OOOOOOO     F luid flow       
+------------------------------------------------------------------------------
+ _____ _____ ____
+|   __|   __|    \    Engineering    |
+|   __|   __|  |  |   Fluid          |
+|_____|__|  |____/    Dynamics       |  www.fluidDynamics.at
+
+------------------------------------------------------------------------------- 
+Licence:
+  This file is part of phasicFlow code. It is a free software for simulating 
+  granular and multiphase flows. You can redistribute it and/or modify it under
+  the terms of GNU General Public License v3 or any other later versions. 
+ 
+  phasicFlow is distributed to help others in their research in the field of 
+  granular and multiphase flows, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+-----------------------------------------------------------------------------*/
+
+/**
+ * @class sphereSurfaceQuadrature
+ * @brief Surface quadrature of a unit sphere for integration of fluid forces.
+ *
+ * The unit sphere is triangulated once (resolution divisions in polar and 
+ * azimuthal directions, the same triangulation as the particle STLs) and the 
+ * centroid and area vector of each triangle are stored. For a particle with 
+ * center c and radius r, quadrature point i is c + r*point(i) and its area 
+ * vector is r^2*area(i), so no surface is constructed for particles. 
+ * Points are ordered ring by ring, so that consecutive points are close to 
+ * each other (useful for cell search from the cell of the last point). 
+ */
+
+#ifndef __sphereSurfaceQuadrature_hpp__
+#define __sphereSurfaceQuadrature_hpp__
+
+#include <vector>
+
+#include "fvCFD.H"
+
+
+namespace pFlow::coupling
+{
+
+class sphereSurfaceQuadrature
+{
+private:
+
+	/// Triangle centroids on the unit sphere
+	std::vector<Foam::vector> 	points_;
+
+	/// Triangle area vectors on the unit sphere
+	std::vector<Foam::vector> 	areas_;
+
+public:
+
+	explicit sphereSurfaceQuadrature(Foam::label resolution);
+
+	/// Number of quadrature points
+	inline
+	size_t size()const
+	{
+		return points_.size();
+	}
+
+	/// Quadrature point i on the unit sphere
+	inline
+	const Foam::vector& point(size_t i)const
+	{
+		return points_[i];
+	}
+
+	/// Area vector of quadrature point i on the unit sphere
+	inline
+	const Foam::vector& area(size_t i)const
+	{
+		return areas_[i];
+	}
+
+};
+
+} // pFlow::coupling
+
+#endif //__sphereSurfaceQuadrature_hpp__
@@ -0,0 +1,192 @@
+/*------------------------------- phasicFlow ---------------------------------
+      O        C enter of
+     O O       E ngineering and
+    O   O      M ultiscale modeling of
+   OOOOOOO     F luid flow       
+------------------------------------------------------------------------------
+  Copyright (C): www.cemf.ir
+  email: hamid.r.norouzi AT gmail.com
+------------------------------------------------------------------------------  
+Licence:
+  This file is part of phasicFlow code. It is a free software for simulating 
+  granular and multiphase flows. You can redistribute it and/or modify it under
+  the terms of GNU General Public License v3 or any other later versions. 
+ 
+  phasicFlow is distributed to help others in their research in the field of 
+  granular and multiphase flows, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+-----------------------------------------------------------------------------*/
+
+/**
+ * @class activeCells
+ * @brief List of fluid cells that receive particle contributions.
+ *
+ * Coupling kernels (zeroing and normalization of source terms, lift force, 
+ * averaged fields) only need to visit the cells that are touched by particles.
+ * In dilute flows (e.g. pneumatic conveying), most cells are empty and a 
+ * loop over all mesh cells is wasted. This class keeps the list of cells that 
+ * contain particle centers or receive a distribution weight from particles 
+ * in this coupling step. 
+ *
+ * Loops fall back to all mesh cells (dense mode) when:
+ * - the fraction of active cells exceeds denseCellFraction, 
+ * - the distribution method smooths fields (changes all cells), or 
+ * - the mesh changed in this step. 
+ *
+ * Fields that were filled in the last step should be zeroed using 
+ * forResetCells which visits both the current and the last active cells. 
+ */
+
+#ifndef __activeCells_hpp__
+#define __activeCells_hpp__
+
+// from std
+#include <vector>
+
+// from OpenFOAM
+#include "OFCompatibleHeader.hpp"
+
+// from phasicFlow-coupling
+#include "couplingMesh.hpp"
+#include "procCMField.hpp"
+
+namespace pFlow::coupling
+{
+
+class distributionBase;
+
+class activeCells
+{
+private:
+
+    /// Reference to coupling mesh
+    const couplingMesh&         cMesh_;
+
+    /// Fraction of active cells above which loops visit all cells
+    Foam::scalar                denseCellFraction_;
+
+    /// Loops visit all cells in this step
+    bool                        dense_ = true;
+
+    /// Loops visited all cells in the last step
+    bool                        lastDense_ = true;
+
+    /// Active cells in this step
+    std::vector<Foam::label>    cells_;
+
+    /// Active cells in this and the last step
+    std::vector<Foam::label>    resetCells_;
+
+    /// Mark of cells that are already in the list
+    std::vector<char>           isActive_;
+
+    /// Add a cell to the list of active cells (if not added yet)
+    inline 
+    void insert(Foam::label celli)
+    {
+        if( !isActive_[celli] )
+        {
+            isActive_[celli] = 1;
+            cells_.push_back(celli);
+        }
+    }
+
+public:
+
+    /// Type info
+    TypeInfoNV("activeCells");
+
+    /// Construct from unresolved dictionary and coupling mesh
+    activeCells(
+        const Foam::dictionary& unresolvedDict,
+        const couplingMesh&     cMesh);
+
+    /// Build the list of active cells for this step. If useWeights is true, 
+    /// cells receiving a distribution weight are also added. distributor is 
+    /// always needed, since coupling terms are smoothed by it even when 
+    /// weights are not used (dense mode if it smooths fields).
+    void update(
+        const Plus::procCMField<Foam::label>&   parCellIndex,
+        const distributionBase&                 distributor,
+        bool                                    useWeights);
+
+    /// Cell lists of the last step are not valid after the mesh is 
+    /// redistributed, the next update is done in dense mode
+    inline
+    void meshRedistributed()
+    {
+        isActive_.clear();
+    }
+
+    /// Loops visit all mesh cells in this step
+    inline 
+    bool dense()const
+    {
+        return dense_;
+    }
+
+    /// Number of active cells in this step
+    inline 
+    size_t size()const
+    {
+        return cells_.size();
+    }
+
+    /// List of active cells in this step
+    inline 
+    const std::vector<Foam::label>& cells()const
+    {
+        return cells_;
+    }
+
+    /// Apply func to active cells of this step (all cells in dense mode)
+    template<typename Function>
+    inline 
+    void forActiveCells(Function&& func)const
+    {
+        if(dense_)
+        {
+            const Foam::label nCells = cMesh_.mesh().nCells();
+            for(Foam::label celli=0; celli<nCells; celli++)
+            {
+                func(celli);
+            }
+        }
+        else
+        {
+            for(const auto celli: cells_)
+            {
+                func(celli);
+            }
+        }
+    }
+
+    /// Apply func to active cells of this and the last step, to reset 
+    /// fields that were filled in the last step
+    template<typename Function>
+    inline 
+    void forResetCells(Function&& func)const
+    {
+        if(dense_ || lastDense_)
+        {
+            const Foam::label nCells = cMesh_.mesh().nCells();
+            for(Foam::label celli=0; celli<nCells; celli++)
+            {
+                func(celli);
+            }
+        }
+        else
+        {
+            for(const auto celli: resetCells_)
+            {
+                func(celli);
+            }
+        }
+    }
+
+}; 
+
+} // pFlow::coupling
+
+#endif //__activeCells_hpp__
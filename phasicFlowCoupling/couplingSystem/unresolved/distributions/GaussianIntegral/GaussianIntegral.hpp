@@ -86,6 +86,11 @@ public:
 
     void updateWeights(const Plus::procCMField<real> & parDiameter) override;
 
+    void meshRedistributed() override
+    {
+        listsConstructed_ = false;
+    }
+
     Foam::word distributionMethodName()const override
     {
         return "GaussianIntegral";
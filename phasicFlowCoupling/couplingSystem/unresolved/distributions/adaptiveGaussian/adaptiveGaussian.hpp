@@ -149,6 +149,12 @@ public:
     /// Update distribution weights based on particle diameters
     void updateWeights(const Plus::procCMField<real> & parDiameter) override;
 
+    /// Neighbor lists are constructed again for the redistributed mesh
+    void meshRedistributed() override
+    {
+        listsConstructed_ = false;
+    }
+
     /// Return the name of the distribution method
     Foam::word distributionMethodName()const override
     {
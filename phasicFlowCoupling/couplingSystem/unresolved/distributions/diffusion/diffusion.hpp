@@ -162,6 +162,12 @@ public:
     /// Apply diffusion smoothing to vector field
     void smoothenField(Foam::volVectorField& field)const override;
 
+    /// Diffusion smoothing changes the field in all cells
+    bool smoothsField()const override
+    {
+        return true;
+    }
+
     /// Return the name of the distribution method
     Foam::word distributionMethodName()const override
     {
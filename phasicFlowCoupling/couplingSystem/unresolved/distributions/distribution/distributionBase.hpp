@@ -163,6 +163,25 @@ public:
 
     /// Get reference to the underlying OpenFOAM mesh
     const Foam::fvMesh& mesh()const;
+
+    /// Get const reference to cell weights of a specific particle
+    inline 
+    const std::vector<cellWeight>& particleWeights(Foam::label parIndx)const
+    {
+        return weights_[parIndx];
+    }
+
+    /// Total number of weights of all particles in this processor
+    inline
+    size_t numWeights()const
+    {
+        size_t n = 0;
+        for(const auto& w:weights_)
+        {
+            n += w.size();
+        }
+        return n;
+    }
     
     /// Distribute scalar value to cells (thread-safe with OpenMP)
     inline
@@ -333,6 +352,19 @@ public:
     virtual
     void smoothenField(Foam::volScalarField& field)const = 0;
 
+    /// Check if smoothenField changes the field (false for no-op smoothing)
+    virtual 
+    bool smoothsField()const
+    {
+        return false;
+    }
+
+    /// Rebuild lists that depend on local cell indices after the mesh 
+    /// is redistributed among processors
+    virtual 
+    void meshRedistributed()
+    {}
+
     /// Get the name of the distribution method (pure virtual)
     virtual 
     Foam::word distributionMethodName()const = 0;
@@ -0,0 +1,81 @@
+/*------------------------------- phasicFlow ---------------------------------
+      O        C enter of
+     O O       E ngineering and
+    O   O      M ultiscale modeling of
+   OOOOOOO     F luid flow       
+------------------------------------------------------------------------------
+  Copyright (C): www.cemf.ir
+  email: hamid.r.norouzi AT gmail.com
+------------------------------------------------------------------------------  
+Licence:
+  This file is part of phasicFlow code. It is a free software for simulating 
+  granular and multiphase flows. You can redistribute it and/or modify it under
+  the terms of GNU General Public License v3 or any other later versions. 
+ 
+  phasicFlow is distributed to help others in their research in the field of 
+  granular and multiphase flows, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+-----------------------------------------------------------------------------*/
+
+/**
+ * @class fluidFieldCache
+ * @brief Derived fluid fields shared by interaction models in a coupling step.
+ *
+ * Drag models need the pressure gradient and lift and surface torque models 
+ * need the fluid vorticity. Each model used to compute these fields on its 
+ * own, so that curl(U) was computed twice (or more) in a coupling step with 
+ * lift active. Fields are computed here on the first request in a coupling 
+ * step and are shared by all models until clear() is called by 
+ * momentumInteraction at the start and the end of the coupling step. 
+ */
+
+#ifndef __fluidFieldCache_hpp__
+#define __fluidFieldCache_hpp__
+
+// from OpenFOAM
+#include "OFCompatibleHeader.hpp"
+
+
+namespace pFlow::coupling
+{
+
+class fluidFieldCache
+{
+private:
+
+    /// Pressure gradient of this coupling step 
+    Foam::tmp<Foam::volVectorField>     gradP_;
+
+    /// Fluid vorticity (curl(U)) of this coupling step 
+    Foam::tmp<Foam::volVectorField>     curlU_;
+
+public:
+
+    /// Type info
+    TypeInfoNV("fluidFieldCache");
+
+    fluidFieldCache() = default;
+
+    fluidFieldCache(const fluidFieldCache&) = delete;
+
+    fluidFieldCache& operator=(const fluidFieldCache&) = delete;
+
+    /// Release all fields (a new coupling step starts)
+    void clear();
+
+    /// Pressure gradient, grad(p) for compressible and grad(p*rho) for 
+    /// incompressible (kinematic) pressure 
+    const Foam::volVectorField& pressureGradient(
+        const Foam::volScalarField& p,
+        const Foam::volScalarField& rho,
+        bool                        isCompressible);
+
+    /// Fluid vorticity, curl(U)
+    const Foam::volVectorField& curlU(const Foam::volVectorField& U);
+
+};
+
+} // pFlow::coupling
+
+#endif //__fluidFieldCache_hpp__
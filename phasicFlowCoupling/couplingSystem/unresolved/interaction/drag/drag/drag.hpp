@@ -46,6 +46,7 @@ Licence:
 // from phasicFlow-coupling
 #include "processorPlus.hpp"
 #include "porosity.hpp"
+#include "dragKernelBuffers.hpp"
 
 
 
@@ -67,6 +68,10 @@ private:
     /// @brief Implicit source term coefficient for momentum equation.
     Foam::volScalarField       Sp_;
 
+    /// @brief Drag coefficient without the semi-implicit factor (only 
+    /// created by drag kernels with semi-implicit drag).
+    uniquePtr<Foam::volScalarField> SpExplicit_ = nullptr;
+
     /// @brief Reference to porosity object (void fraction).
 	const porosity& 			porosity_;
 
@@ -76,6 +81,18 @@ private:
     /// @brief Flag indicating compressible flow solver.
 	bool 						isCompressible_ = false;
 
+    /// @brief Per-particle buffers of the drag kernel.
+    dragKernelBuffers           kernelBuffers_;
+
+    /// @brief Average drag over the coupling interval (semi-implicit drag).
+    Foam::Switch                semiImplicit_;
+
+    /// @brief Density of particles (particleDensity of unresolved dict).
+    Foam::scalar                particleDensity_ = 0;
+
+    /// @brief Gravity acting on particles in DEM (gravity of unresolved dict).
+    Foam::vector                gravity_ = Foam::vector(0,0,0);
+
 protected:
 
     /// @brief Initialize source terms to zero.
@@ -95,6 +112,66 @@ protected:
         return Sp_;
     }
 
+    /// @brief Drag coefficient without the semi-implicit factor, filled by 
+    /// the drag kernel like Sp (created on the first call).
+    Foam::volScalarField& SpExplicit();
+
+    /// @brief If drag is averaged over the coupling interval.
+    inline
+    bool semiImplicit()const
+    {
+        return semiImplicit_;
+    }
+
+    /// @brief Time over which fluid forces of an exchange act on particles 
+    /// in DEM (couplingInterval fluid time steps).
+    Foam::scalar couplingDeltaT()const;
+
+    /// @brief Factor g of the drag coefficient sp for semi-implicit drag 
+    /// (1 for explicit drag). 
+    /// With constant fluid velocity, the drag D = sp*ur of a particle relaxes 
+    /// as exp(-t/tau), tau = rhoP*vp/sp, towards Deq, the drag that balances 
+    /// gravity and the pressure gradient force. The mean drag over the coupling 
+    /// interval dt is f*D0 + (1-f)*Deq, f = (1-exp(-x))/x, x = dt/tau. 
+    /// Contact forces are not known here, and a particle held by contacts 
+    /// (settled or packed bed) does not relax towards Deq: Deq would cancel 
+    /// its weight. Deq is therefore bounded by the actual drag, only its 
+    /// component along D0 clipped to [0, |D0|] is used, so that g = f + (1-f)*c. 
+    /// The mean drag lies between f*D0 and D0. It is D0 at terminal slip and 
+    /// zero without slip, but it is underestimated (down to f*D0) for 
+    /// contact-supported particles with a drag larger than Deq. 
+    inline
+    Foam::scalar semiImplicitFactor
+    (
+        Foam::scalar sp, 
+        Foam::scalar vp, 
+        Foam::scalar dt,
+        const Foam::vector& ur,
+        const Foam::vector& pGrad
+    )const
+    {
+        if(!semiImplicit_ || sp <= 0) return 1.0;
+
+        const Foam::scalar x = dt*sp/(particleDensity_*vp);
+        const Foam::scalar f = x < 1.0e-6? 1.0 - 0.5*x: (1.0 - Foam::exp(-x))/x;
+
+        const Foam::vector D0 = sp*ur;
+        const Foam::scalar magSqrD0 = Foam::magSqr(D0);
+        if(magSqrD0 < Foam::VSMALL) return f;
+
+        const Foam::vector Deq = vp*pGrad - (particleDensity_*vp)*gravity_;
+        const Foam::scalar c = Foam::max(Foam::min((Deq & D0)/magSqrD0, 1.0), 0.0);
+
+        return f + (1.0 - f)*c;
+    }
+
+    /// @brief Access per-particle buffers of the drag kernel.
+    inline
+    dragKernelBuffers& kernelBuffers()
+    {
+        return kernelBuffers_;
+    }
+
 public:
 
     /// Type info
@@ -119,8 +196,8 @@ public:
         (uCS, prsty)
     );
 
-    /// @brief Compute pressure gradient contribution to drag.
-    Foam::tmp<Foam::volVectorField> 
+    /// @brief Pressure gradient contribution to drag (cached for the coupling step).
+    const Foam::volVectorField& 
     pressureGradient(const Foam::volScalarField& rho)const;
 
     /// @brief Check if flow is in compressible regime.
@@ -177,6 +254,17 @@ public:
       return Sp_;
     }
 
+    /// @brief Drag coefficient of the fluid momentum equation without the 
+    /// semi-implicit factor (Sp for explicit drag). The relaxation time of 
+    /// drag coupling is evaluated from it, since the scaled Sp grows as 
+    /// 1/dt for dt >> tau.
+    inline
+    const Foam::volScalarField& SpExplicit()const
+    {
+        if(SpExplicit_) return *SpExplicit_;
+        return Sp_;
+    }
+
     /// @brief Get reference to drag dictionary.
     const Foam::dictionary& dict()const;
 
@@ -0,0 +1,145 @@
+/*------------------------------- phasicFlow ---------------------------------
+      O        C enter of
+     O O       E ngineering and
+    O   O      M ultiscale modeling of
+   OOOOOOO     F luid flow       
+------------------------------------------------------------------------------
+  Copyright (C): www.cemf.ir
+  email: hamid.r.norouzi AT gmail.com
+------------------------------------------------------------------------------  
+Licence:
+  This file is part of phasicFlow code. It is a free software for simulating 
+  granular and multiphase flows. You can redistribute it and/or modify it under
+  the terms of GNU General Public License v3 or any other later versions. 
+ 
+  phasicFlow is distributed to help others in their research in the field of 
+  granular and multiphase flows, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+-----------------------------------------------------------------------------*/
+
+/**
+ * @class dragKernelBuffers
+ * @brief Per-particle buffers (structure of arrays) of the drag kernel.
+ *
+ * Drag force is calculated in three phases: 
+ * 1. gather: fluid properties are read from the cell of each particle and 
+ *    Reynolds number, fluid volume fraction and viscosity are stored in 
+ *    contiguous buffers, 
+ * 2. closure: the dimensionless drag of the closure is evaluated for all 
+ *    particles in one uniform loop (static scheduling, simd lanes), 
+ * 3. scatter: forces are added to particles and source terms are 
+ *    distributed to cells. 
+ *
+ * Buffers keep their capacity between coupling steps to avoid allocations. 
+ */
+
+#ifndef __dragKernelBuffers_hpp__
+#define __dragKernelBuffers_hpp__
+
+// from std
+#include <vector>
+
+// from OpenFOAM
+#include "OFCompatibleHeader.hpp"
+
+
+namespace pFlow::coupling
+{
+
+class dragKernelBuffers
+{
+private:
+
+    /// Reynolds number of particles
+    std::vector<Foam::scalar>   Re_;
+
+    /// Fluid volume fraction in the cell of particles
+    std::vector<Foam::scalar>   ep_;
+
+    /// Dynamic viscosity of fluid in the cell of particles
+    std::vector<Foam::scalar>   mu_;
+
+    /// Dimensionless drag of particles
+    std::vector<Foam::scalar>   f_;
+
+public:
+
+    /// Default construct (empty buffers)
+    dragKernelBuffers() = default;
+
+    /// Resize all buffers to the number of particles
+    inline 
+    void resize(size_t numPar)
+    {
+        Re_.resize(numPar);
+        ep_.resize(numPar);
+        mu_.resize(numPar);
+        f_.resize(numPar);
+    }
+
+    /// Store gathered values of particle i
+    inline 
+    void set(size_t i, Foam::scalar Re, Foam::scalar ep, Foam::scalar mu)
+    {
+        Re_[i] = Re;
+        ep_[i] = ep;
+        mu_[i] = mu;
+    }
+
+    /// Mark particle i as not located in the mesh (safe closure inputs)
+    inline 
+    void setInactive(size_t i)
+    {
+        Re_[i] = 1.0;
+        ep_[i] = 1.0;
+        mu_[i] = 0.0;
+    }
+
+    inline 
+    Foam::scalar Re(size_t i)const
+    {
+        return Re_[i];
+    }
+
+    inline 
+    Foam::scalar ep(size_t i)const
+    {
+        return ep_[i];
+    }
+
+    inline 
+    Foam::scalar mu(size_t i)const
+    {
+        return mu_[i];
+    }
+
+    inline 
+    Foam::scalar f(size_t i)const
+    {
+        return f_[i];
+    }
+
+    /// Evaluate the dimensionless drag of closure for all particles 
+    template<typename DragClosureType>
+    inline
+    void evaluateClosure(const DragClosureType& closure)
+    {
+        const size_t numPar = f_.size();
+        const Foam::scalar* __restrict__ Re = Re_.data();
+        const Foam::scalar* __restrict__ ep = ep_.data();
+        Foam::scalar* __restrict__ f = f_.data();
+
+        // uniform work: static schedule and simd lanes in each thread
+        #pragma omp parallel for simd schedule (static)
+        for(size_t i=0; i<numPar; i++)
+        {
+            f[i] = closure.dimlessDrag(Re[i], ep[i]);
+        }
+    }
+
+}; 
+
+} // pFlow::coupling
+
+#endif //__dragKernelBuffers_hpp__
@@ -0,0 +1,232 @@
+/*------------------------------- phasicFlow ---------------------------------
+      O        C enter of
+     O O       E ngineering and
+    O   O      M ultiscale modeling of
+   OOOOOOO     F luid flow       
+------------------------------------------------------------------------------
+  Copyright (C): www.cemf.ir
+  email: hamid.r.norouzi AT gmail.com
+------------------------------------------------------------------------------  
+Licence:
+  This file is part of phasicFlow code. It is a free software for simulating 
+  granular and multiphase flows. You can redistribute it and/or modify it under
+  the terms of GNU General Public License v3 or any other later versions. 
+ 
+  phasicFlow is distributed to help others in their research in the field of 
+  granular and multiphase flows, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+-----------------------------------------------------------------------------*/
+
+/**
+ * @class tabulatedDrag
+ * @brief Lookup-table wrapper for any drag closure.
+ *
+ * The dimensionless drag of a closure (DiFelice, Beetstra, Rong, ...) is 
+ * tabulated once at construction. Afterwards, dimlessDrag is evaluated by 
+ * bilinear interpolation, which replaces the pow/exp calls of the closure 
+ * by two logs, a sqrt and an exp. Values outside the table range are 
+ * evaluated by the closure itself. 
+ *
+ * The table holds log(f) on a grid which is uniform in x = log(Re) and in 
+ * y = log(ep) - 2 sqrt(1-ep). The grid in ep is therefore non-uniform: it 
+ * is dense at low ep, where f ~ ep^-n varies strongly, and near ep = 1, 
+ * where closures with sqrt(1-ep) (Beetstra) have an infinite slope. 
+ * The table is split at the fluid volume fractions where the closure 
+ * jumps (e.g. ErgunWenYu at ep = 0.8), so that no table cell interpolates 
+ * across a jump. Jumps are found by sampling the closure on a fine grid in 
+ * ep and bisecting large differences of neighbours: a jump keeps its 
+ * height down to the machine precision, a steep slope does not. 
+ *
+ * The grid is refined in the direction (log(Re) or ep) with the larger 
+ * interpolation error until the largest relative error falls below the 
+ * tolerance. The table size is limited to maxTableSize entries (default 
+ * 65536, 512 kB in double precision), so that lookups stay in cache. If 
+ * the tolerance is not reached within this size, a fatal error is raised.
+ *
+ * The cost per call of the table and of the closure is measured after the 
+ * table is built. Cheap closures (e.g. ErgunWenYu) can be faster than the 
+ * table, a warning is given in this case. 
+ *
+ * Settings are read from the (optional) sub-dictionary tabulation of drag:
+ * @code
+ * tabulation
+ * {
+ *     ReMin         1.0e-3;  // default
+ *     ReMax         1.0e+5;  // default
+ *     epMin         0.1;     // default
+ *     epMax         1.0;     // default
+ *     tolerance     5.0e-3;  // relative accuracy target (default)
+ *     maxTableSize  65536;   // default
+ * }
+ * @endcode
+ *
+ * @tparam DragClosureType The wrapped drag closure. 
+ */
+
+#ifndef __tabulatedDrag_hpp__
+#define __tabulatedDrag_hpp__
+
+// from std
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <chrono>
+#include <limits>
+
+// from OpenFOAM
+#include "OFCompatibleHeader.hpp"
+
+#include "typeInfo.hpp"
+#include "processorPlus.hpp"
+
+namespace pFlow::coupling
+{
+
+template<typename DragClosureType>
+class tabulatedDrag
+{
+private:
+
+    /// The closure which is tabulated
+    DragClosureType             closure_;
+
+    /// Range of Reynolds number in the table
+    Foam::scalar                ReMin_;
+
+    Foam::scalar                ReMax_;
+
+    /// Range of fluid volume fraction in the table
+    Foam::scalar                epMin_;
+
+    Foam::scalar                epMax_;
+
+    /// log(ReMin)
+    Foam::scalar                xMin_;
+
+    /// Inverse of grid spacing in log(Re)
+    Foam::scalar                invDx_ = 0;
+
+    /// Number of grid points in log(Re) and in ep (in each segment)
+    Foam::label                 nx_ = 0;
+
+    Foam::label                 ny_ = 0;
+
+    /// Lower bound of ep in segments of the table (split at jumps)
+    std::vector<Foam::scalar>   segEpMin_;
+
+    /// Upper bound of ep in segments of the table
+    std::vector<Foam::scalar>   segEpMax_;
+
+    /// Lower bound of grid coordinate y in segments
+    std::vector<Foam::scalar>   segYMin_;
+
+    /// Inverse of grid spacing in y in segments
+    std::vector<Foam::scalar>   segInvDy_;
+
+    /// Tabulated log of dimensionless drag (ep varies fastest, 
+    /// segments are next to each other in a row of log(Re))
+    std::vector<Foam::scalar>   table_;
+
+    /// Grid coordinate of fluid volume fraction
+    static inline 
+    Foam::scalar epCoord(Foam::scalar ep)
+    {
+        return Foam::log(ep) - 2*Foam::sqrt(1-ep);
+    }
+
+    /// Fluid volume fraction of grid coordinate y in [epA, epB]
+    static 
+    Foam::scalar epOfCoord(Foam::scalar y, Foam::scalar epA, Foam::scalar epB);
+
+    /// Fluid volume fractions in (epMin, epMax) at which the closure jumps 
+    /// by more than half of the tolerance (in log(f))
+    std::vector<Foam::scalar> findJumps(Foam::scalar tolerance)const;
+
+    /// Measure the cost per call of the table and the closure and warn 
+    /// if the table is slower
+    void compareCost()const;
+
+    /// Number of table entries in a row of log(Re)
+    inline 
+    Foam::label rowSize()const
+    {
+        return static_cast<Foam::label>(segEpMin_.size())*ny_;
+    }
+
+    /// Fill the table on nx points in log(Re) and ny points in ep in 
+    /// each segment
+    void fillTable(Foam::label nx, Foam::label ny);
+
+    /// Largest relative error of interpolation at points located at 
+    /// (fx, fy) fraction of table cells, i.e. (0.5,0) is mid-point in log(Re)
+    Foam::scalar maxRelativeError(Foam::scalar fx, Foam::scalar fy)const;
+
+    /// Segment of the table that contains ep
+    inline 
+    Foam::label segment(Foam::scalar ep)const
+    {
+        Foam::label s = 0;
+        const Foam::label nSeg = static_cast<Foam::label>(segEpMin_.size());
+        while( s+1 < nSeg && ep >= segEpMin_[s+1] ) s++;
+        return s;
+    }
+
+    /// Bilinear interpolation in segment s of the table (Re and ep are inside the range)
+    inline 
+    Foam::scalar interpolate(Foam::scalar Re, Foam::scalar ep, Foam::label s)const
+    {
+        const Foam::scalar x = (Foam::log(Re) - xMin_)*invDx_;
+        const Foam::scalar y = (epCoord(ep) - segYMin_[s])*segInvDy_[s];
+
+        const Foam::label i = Foam::min(static_cast<Foam::label>(x), nx_-2);
+        const Foam::label j = Foam::min(static_cast<Foam::label>(y), ny_-2);
+
+        const Foam::scalar tx = x - i;
+        const Foam::scalar ty = y - j;
+
+        const Foam::scalar* f0 = &table_[i*rowSize() + s*ny_ + j];
+        const Foam::scalar* f1 = f0 + rowSize();
+
+        return Foam::exp
+        (
+            (1-tx)*((1-ty)*f0[0] + ty*f0[1]) + 
+               tx *((1-ty)*f1[0] + ty*f1[1])
+        );
+    }
+
+public:
+
+    // type info
+    TypeInfoTemplate11("tabulated", DragClosureType);
+
+    /// Construct the closure from drag dictionary and build the table
+    tabulatedDrag(const Foam::dictionary& dict);
+
+    virtual ~tabulatedDrag() = default;
+
+    inline
+    Foam::scalar dimlessDrag(Foam::scalar Re, Foam::scalar ep)const
+    {
+        if( Re < ReMin_ || Re > ReMax_ || ep < epMin_ || ep > epMax_ )
+        {
+            return closure_.dimlessDrag(Re, ep);
+        }
+        
+        return interpolate(Re, ep, segment(ep));
+    }
+
+    inline 
+    Foam::scalar operator()(Foam::scalar Re, Foam::scalar ep)const
+    {
+        return dimlessDrag(Re, ep);
+    }
+
+};
+
+} // pFlow::coupling
+
+#include "tabulatedDrag.C"
+
+#endif //__tabulatedDrag_hpp__
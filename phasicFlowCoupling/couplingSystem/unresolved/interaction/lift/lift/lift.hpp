@@ -167,9 +167,8 @@ public:
     /// Returns the configuration dictionary for this model
     const Foam::dictionary& dict()const;
     
-    /// Computes fluid vorticity field from velocity
-    static
-    Foam::tmp<Foam::volVectorField> fluidVorticity(const Foam::volVectorField& U);
+    /// Fluid vorticity field from velocity (cached for the coupling step)
+    const Foam::volVectorField& fluidVorticity(const Foam::volVectorField& U)const;
 
     /// Retrieves lift model configuration dictionary
     static
@@ -115,6 +115,9 @@ public:
         const Plus::realProcCMField&    diameter,
         Plus::realx3ProcCMField&        particleTorque) = 0;
 
+    /// Fluid vorticity field from velocity (shared with lift model in the coupling step)
+    const Foam::volVectorField& fluidVorticity(const Foam::volVectorField& U)const;
+
     /// Returns the configuration dictionary for this model
     const Foam::dictionary& dict()const;
     
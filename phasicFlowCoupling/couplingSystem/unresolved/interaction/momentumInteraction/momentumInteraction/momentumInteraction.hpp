@@ -100,6 +100,13 @@ private:
     /// Timer for tracking performance of momentum interaction calculations
     Timer                      momentumInteractionTimer_;
 
+    /// Explicit source term of drag and lift, assembled once per coupling step 
+    /// (only constructed when lift is active, otherwise drag Su is used)
+    uniquePtr<Foam::volVectorField> SuAll_ = nullptr;
+
+    /// Add lift force to drag source term in SuAll_
+    void assembleSourceTerms();
+
    
 public:
 
@@ -113,10 +120,11 @@ public:
     /// Destructor
     virtual ~momentumInteraction() = default;
 
-    /// Returns the source term (Su) for momentum equation from drag forces
+    /// Returns the source term (Su) for momentum equation from drag and lift forces
     inline
     const Foam::volVectorField& Su()const
     {
+        if(SuAll_) return *SuAll_;
         return std::as_const<const drag&>(*drag_).Su();
     }
 
@@ -127,6 +135,13 @@ public:
         return std::as_const<const drag&>(*drag_).Sp();
     }
 
+    /// Returns the drag coefficient without the semi-implicit factor (Sp for explicit drag)
+    inline
+    const Foam::volScalarField& SpExplicit()const
+    {
+        return std::as_const<const drag&>(*drag_).SpExplicit();
+    }
+
     /// Returns the lift force field acting on particles
     inline
     Foam::tmp<Foam::volVectorField> liftForce()const
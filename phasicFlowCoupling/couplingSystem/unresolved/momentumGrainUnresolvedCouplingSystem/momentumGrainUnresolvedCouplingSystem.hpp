@@ -186,6 +186,12 @@ public:
 	/// Calculate local porosity (fluid volume fraction) in each cell.
     void calculatePorosity() override;
 
+	/// Interpolate porosity between the last two exchanges in a fluid time step without exchange.
+    void interpolatePorosity() override
+    {
+        porosity_->updateInInterval();
+    }
+
 	/// Calculate momentum coupling forces (drag, lift, virtual mass) between particles and fluid.
     void calculateMomentumCoupling() override;
 
@@ -195,20 +201,32 @@ public:
 	/// Calculate mass coupling (not yet implemented for grain particles).
     void calculateMassCoupling() override;
 
-	/// Get the fluid volume fraction field (porosity) in cells.
-	/// @return Const reference to the volScalarField representing fluid volume fraction.
+	/// Get the fluid volume fraction field (porosity) of the fluid equations in cells.
+	/// @return Const reference to the fluid volume fraction, interpolated over the coupling interval.
     const Foam::volScalarField& alpha()const override
     {
-        return porosity_().alpha();
+        return porosity_().fluidAlpha();
     }
 
 	/// Get the implicit coefficient of momentum source term (Sp in Sp*U+Su).
-	/// @return Temporary volScalarField containing the implicit momentum source coefficient.
-    Foam::tmp<Foam::volScalarField> Sp()const override;
+	/// @return Const reference to the implicit momentum source coefficient of this coupling step.
+    const Foam::volScalarField& Sp()const override
+    {
+        return momentumInteraction_.Sp();
+    }
+
+	/// Get the drag coefficient without the semi-implicit factor of drag (Sp for explicit drag).
+    const Foam::volScalarField& SpExplicit()const override
+    {
+        return momentumInteraction_.SpExplicit();
+    }
 
 	/// Get the explicit part of momentum source term (Su in Sp*U+Su).
-	/// @return Temporary volVectorField containing the explicit momentum source.
-    Foam::tmp<Foam::volVectorField> Su()const override;
+	/// @return Const reference to the explicit momentum source (drag and lift) of this coupling step.
+    const Foam::volVectorField& Su()const override
+    {
+        return momentumInteraction_.Su();
+    }
     
 	/// Get the heat source term (not yet implemented).
 	/// @return Temporary volScalarField (returns null pointer; function not implemented).
@@ -31,6 +31,7 @@ Licence:
 #include "couplingMesh.hpp"
 #include "procCMFields.hpp"
 #include "distributionBase.hpp"
+#include "activeCells.hpp"
 
 namespace pFlow::coupling
 {
@@ -61,6 +62,58 @@ private:
 	/// Reference to distribution 
 	const distributionBase&			distribution_;
 
+	/// Update solid volume only for particles whose contribution changed
+	Foam::Switch 					incremental_;
+
+	/// Number of incremental updates between two full rebuilds
+	Foam::label 					fullRebuildInterval_;
+
+	/// Number of incremental updates since the last full rebuild
+	Foam::label 					nIncrementalUpdates_ = 0;
+
+	/// If solid volume has been built at least once
+	bool 							solidVolBuilt_ = false;
+
+	/// Solid volume of cells which is kept between updates (incremental mode)
+	Foam::volScalarField::Internal 	solidVol_;
+
+	/// Solid volume contribution of each particle to cells in the last update
+	Plus::procCMField<std::vector<distributionBase::cellWeight>> parContributions_;
+
+	/// Cells whose solid volume changed in the last incremental update
+	std::vector<Foam::label> 		changedCells_;
+
+	/// Number of fluid time steps between two coupling exchanges
+	Foam::label 					interval_;
+
+	/// alpha of the fluid equations, interpolated over the coupling 
+	/// interval (only created for couplingInterval > 1)
+	uniquePtr<Foam::volScalarField> alphaInterval_ = nullptr;
+
+	/// Interpolated alpha before the last exchange (couplingInterval > 1)
+	Foam::scalarField 				alphaStart_;
+
+	/// Set the interpolated alpha to the linear interpolation between 
+	/// alphaStart_ and alpha of the last exchange in step (1 to interval_) 
+	/// of the coupling interval
+	void interpolateAlpha(Foam::label step);
+
+	/// Check if solid volume should be built from zero in this update
+	bool requireFullRebuild()const;
+
+	/// Solid volume contribution of particle parIndx to cells 
+	void particleContribution(
+		const distributionBase& distributor,
+		Foam::label parIndx,
+		Foam::label parCellIndx,
+		std::vector<distributionBase::cellWeight>& contribution)const;
+
+	/// Build solid volume of all cells from zero
+	void rebuildSolidVol(const distributionBase& distributor);
+
+	/// Subtract old and add new contributions of particles that changed 
+	void incrementSolidVol(const distributionBase& distributor);
+
 protected:
 
     void setAlphaMin(Foam::scalar newAlphaMin)
@@ -101,6 +154,11 @@ protected:
         return solidVolTmp;
     }
 
+    /// Fill the internal field of alpha from the solid volume distributed 
+    /// by the weights of distribution. In incremental mode, alpha is only 
+    /// updated in cells whose solid volume changed. 
+    bool internalFieldFromDistribution();
+
 public:
 
 	/// Type info
@@ -144,12 +202,23 @@ public:
 
 	// - Methods
 		
-		/// Const access to alpha
+		/// Const access to alpha of the last exchange (used by drag, 
+		/// averaging and written to time folders)
 		inline
 		const Foam::volScalarField& alpha()const
 		{
 			return *this;
 		}
+
+		/// alpha of the fluid equations (continuity). With couplingInterval > 1, 
+		/// it is interpolated from its value before the last exchange to alpha 
+		/// over the fluid time steps of the interval. 
+		inline
+		const Foam::volScalarField& fluidAlpha()const
+		{
+			if(alphaInterval_) return *alphaInterval_;
+			return *this;
+		}
 		 
 		const Foam::fvMesh& mesh()const;
 		
@@ -169,6 +238,9 @@ public:
 
 		/// Return cell index of particles  
 		const Plus::procCMField<Foam::label>& parCellIndex()const;
+
+		/// Return cells touched by particles in this coupling step
+		const activeCells& activeCellList()const;
 		
 
 		/// Retrun center mass position of particles 
@@ -192,13 +264,27 @@ public:
             return distribution_;
         }
 
-		/// Calculate porosity based on particles positions 
+		/// Calculate porosity based on particles positions. 
+		/// With couplingInterval > 1, fluidAlpha is then interpolated 
+		/// towards it in the fluid time steps of the interval 
+		/// (see updateInInterval).
 		void calculatePorosity();
 
+		/// Advance fluidAlpha in a fluid time step without 
+		/// coupling exchange
+		void updateInInterval();
+
 		/// Fill the internal field of alpha
 		virtual
 		bool internalFieldUpdate() = 0;
 
+		/// Is incremental update of solid volume active
+		inline 
+		bool incremental()const
+		{
+			return incremental_;
+		}
+
 		/// Return number of center mass points found in this mesh (processor)
 		int32 numInMesh()const;
 		
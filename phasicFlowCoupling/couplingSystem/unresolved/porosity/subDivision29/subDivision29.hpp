@@ -40,6 +40,12 @@ class subDivision29
 : 
 	public porosity
 {
+private:
+
+	/// True if distribution is subDivision29 and the sub-points located by  
+	/// the distribution are used for porosity
+	const bool 	sharedSubPoints_;
+
 public:
 
 	/// Type info
@@ -64,6 +70,12 @@ public:
 
 	bool internalFieldUpdate() override;
 
+	/// Weights of the distribution are required when sub-points are shared
+	bool requireCellDistribution()const override
+	{
+		return sharedSubPoints_;
+	}
+
 
 }; 
 
@@ -41,6 +41,12 @@ class subDivision9
 : 
 	public porosity
 {
+private:
+
+	/// True if distribution is subDivision9 and the sub-points located by  
+	/// the distribution are used for porosity
+	const bool 	sharedSubPoints_;
+
 public:
 
 	/// Type info
@@ -65,6 +71,12 @@ public:
 
 	bool internalFieldUpdate() override;
 
+	/// Weights of the distribution are required when sub-points are shared
+	bool requireCellDistribution()const override
+	{
+		return sharedSubPoints_;
+	}
+
 
 }; 
 
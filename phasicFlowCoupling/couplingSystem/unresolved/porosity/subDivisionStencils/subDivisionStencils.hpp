@@ -0,0 +1,148 @@
+/*------------------------------- phasicFlow ---------------------------------
+      O        C enter of
+     O O       E ngineering and
+    O   O      M ultiscale modeling of
+   OOOOOOO     F luid flow       
+------------------------------------------------------------------------------
+  Copyright (C): www.cemf.ir
+  email: hamid.r.norouzi AT gmail.com
+------------------------------------------------------------------------------  
+Licence:
+  This file is part of phasicFlow code. It is a free software for simulating 
+  granular and multiphase flows. You can redistribute it and/or modify it under
+  the terms of GNU General Public License v3 or any other later versions. 
+ 
+  phasicFlow is distributed to help others in their research in the field of 
+  granular and multiphase flows, but WITHOUT ANY WARRANTY; without even the
+  implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+-----------------------------------------------------------------------------*/
+
+/**
+ * @file subDivisionStencils.hpp
+ * @brief Unit-sphere offset stencils of the sub-division methods.
+ *
+ * The sub-points of the subDivision29 and subDivision9 methods are fixed 
+ * offsets from the particle center that only scale with particle radius. 
+ * They are tabulated here once (at compile time) for a unit sphere and 
+ * scaled by the radius of each particle at runtime. These stencils are shared 
+ * by the porosity models (subDivision29, subDivision29Mod, subDivision9) and 
+ * the distribution methods (subDivision29Dist, subDivision9Dist). 
+ */
+
+#ifndef __subDivisionStencils_hpp__
+#define __subDivisionStencils_hpp__
+
+// from std
+#include <array>
+
+// from OpenFOAM
+#include "OFCompatibleHeader.hpp"
+
+// from phasicFlow
+#include "types.hpp"
+
+namespace pFlow::coupling::subDivisionStencils
+{
+
+/// Offset of a sub-point from the particle center (unit sphere)
+using unitOffset = std::array<real,3>;
+
+/// sin(45) = cos(45)
+inline constexpr real sc45 = 0.7071067811865475;
+
+/// Radius of the inner shell of subDivision29 (unit sphere)
+inline constexpr real innerShell29 = 0.62392;
+
+/// Radius of the outer shell of subDivision29 (unit sphere)
+inline constexpr real outerShell29 = 0.917896;
+
+/// Radius of the sub-points of subDivision9 (unit sphere)
+inline constexpr real shell9 = 0.5*1.48075;
+
+/// Number of sub-volumes in subDivision29
+inline constexpr int32 nSubVol29 = 29;
+
+/// Number of sub-volumes in subDivision9
+inline constexpr int32 nSubVol9 = 9;
+
+/// 14 directions of a shell: 8 diagonal directions and 6 axis directions 
+inline constexpr std::array<unitOffset, 14> shellDirections14 =
+{{
+    { 0.5, 0.5, sc45}, {-0.5, 0.5, sc45},
+    { 0.5, 0.5,-sc45}, {-0.5, 0.5,-sc45},
+    {-0.5,-0.5,-sc45}, { 0.5,-0.5,-sc45},
+    {-0.5,-0.5, sc45}, { 0.5,-0.5, sc45},
+    {-1.0, 0.0, 0.0 }, { 0.0,-1.0, 0.0 }, { 0.0, 0.0,-1.0 },
+    { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, 1.0 }
+}};
+
+/// Scale a set of directions to a shell of radius r
+template<std::size_t N>
+constexpr std::array<unitOffset, N> scaledShell
+(
+    const std::array<unitOffset, N>& dirs, 
+    real r
+)
+{
+    std::array<unitOffset, N> shell{};
+    for(std::size_t n=0; n<N; n++)
+    {
+        shell[n] = {r*dirs[n][0], r*dirs[n][1], r*dirs[n][2]};
+    }
+    return shell;
+}
+
+/// Outer shell of subDivision29 (14 sub-points)
+inline constexpr std::array<unitOffset, 14> outer14 = 
+    scaledShell(shellDirections14, outerShell29);
+
+/// Both shells of subDivision29 (28 sub-points, inner shell first)
+inline constexpr std::array<unitOffset, 28> full28 = []()
+{
+    const auto inner = scaledShell(shellDirections14, innerShell29);
+    std::array<unitOffset, 28> stencil{};
+    for(std::size_t n=0; n<14; n++)
+    {
+        stencil[n] = inner[n];
+        stencil[n+14] = outer14[n];
+    }
+    return stencil;
+}();
+
+/// 8 diagonal sub-points of subDivision9 (the 9th one is the center)
+inline constexpr std::array<unitOffset, 8> diagonal8 = []()
+{
+    std::array<unitOffset, 8> diagonals{};
+    for(std::size_t n=0; n<8; n++)
+    {
+        diagonals[n] = shellDirections14[n];
+    }
+    return scaledShell(diagonals, shell9);
+}();
+
+/// Place a unit stencil on a particle with position pPos and radius pRad 
+template<typename PointType, std::size_t N, unsigned Size>
+inline
+void placeStencil
+(
+    const std::array<unitOffset, N>&    stencil,
+    const PointType&                    pPos,
+    const real                          pRad,
+    Foam::FixedList<PointType, Size>&   points
+)
+{
+    static_assert(N == Size, "stencil and point list sizes do not match");
+    
+    for(unsigned n=0; n<Size; n++)
+    {
+        points[n] = pPos + PointType(
+            pRad*stencil[n][0], 
+            pRad*stencil[n][1], 
+            pRad*stencil[n][2]);
+    }
+}
+
+} // pFlow::coupling::subDivisionStencils
+
+#endif //__subDivisionStencils_hpp__
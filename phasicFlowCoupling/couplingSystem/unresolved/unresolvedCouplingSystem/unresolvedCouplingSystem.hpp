@@ -65,6 +65,8 @@ Licence:
 
 #include "couplingSystem.hpp"
 #include "distributionBase.hpp"
+#include "activeCells.hpp"
+#include "fluidFieldCache.hpp"
 #include "virtualConstructor.hpp"
 
 
@@ -81,6 +83,31 @@ private:
     /// Distribution method for mapping particle properties to fluid cells.
     uniquePtr<distributionBase>         distribution_;
 
+    /// Cells that receive particle contributions in this coupling step.
+    activeCells                         activeCells_;
+
+    /// Derived fluid fields (grad(p), curl(U)) shared by interaction models in a coupling step.
+    mutable fluidFieldCache             fluidFields_;
+
+    /// Limit the fluid time step by the relaxation time of drag coupling (couplingTimeStep dict).
+    Foam::Switch                        dragTimeStep_;
+
+    /// Maximum ratio of coupling interval to drag relaxation time.
+    Foam::scalar                        maxDragCo_;
+
+    /// Density of particles (unresolved dict, used by couplingTimeStep and semi-implicit drag).
+    Foam::scalar                        particleDensity_;
+
+protected:
+
+    /// Reset neighbor lists of distribution and active cells after the 
+    /// fluid mesh is redistributed among processors.
+    void meshRedistributed() override
+    {
+        distribution_->meshRedistributed();
+        activeCells_.meshRedistributed();
+    }
+
 public:
 
     /// Constructor initializing the unresolved coupling system with particle and fluid mesh information.
@@ -146,14 +173,79 @@ public:
     /// Update distribution weights based on current particle positions.
     void updateDistributionWeights()
     {
-        if(distribution_)
-            distribution_->updateWeights(this->particleDiameter());
+        if(!distribution_) return;
+        
+        distribution_->updateWeights(this->particleDiameter());
+
+        if(this->profiler().active())
+        {
+            this->profiler().count
+            (
+                couplingProfiler::particleWeights, 
+                distribution_->numWeights()
+            );
+        }
     }
 
+    /// Update the list of cells touched by particles (center cells and cells receiving 
+    /// distribution weights if useDistributionWeights is true).
+    void updateActiveCells(bool useDistributionWeights)
+    {
+        activeCells_.update
+        (
+            parCellIndex(), 
+            *distribution_,
+            useDistributionWeights
+        );
+    }
+
+    /// Const reference to the list of cells touched by particles in this coupling step.
+    inline
+    const activeCells& activeCellList()const
+    {
+        return activeCells_;
+    }
+
+    /// Derived fluid fields of this coupling step, computed once and shared by interaction models.
+    inline
+    fluidFieldCache& fluidFields()const
+    {
+        return fluidFields_;
+    }
+
+    /// Is the fluid time step limited by the relaxation time of drag coupling?
+    inline
+    bool dragTimeStep()const
+    {
+        return dragTimeStep_;
+    }
+
+    /// Maximum ratio of coupling interval to drag relaxation time (drag Courant number).
+    inline
+    Foam::scalar maxDragCo()const
+    {
+        return maxDragCo_;
+    }
+
+    /// Density of particles given in the unresolved dict (fatal error if it is not given).
+    Foam::scalar particleDensity()const;
+
+    /// Minimum relaxation time of drag coupling over cells with particles in all processors. 
+    /// The relative velocity of fluid and particles relaxes with the rate 
+    /// Sp*(1/(rhoP*(1-alpha)) + 1/(rho*alpha)), which is evaluated from the drag coefficient 
+    /// of the last coupling step without the semi-implicit factor (SpExplicit) 
+    /// (collective call, GREAT if there is no drag).
+    Foam::scalar dragRelaxationTime()const;
+
     /// Pure virtual method to calculate local fluid volume fraction (porosity) in cells.
     virtual
     void calculatePorosity() =0;
 
+    /// Pure virtual method to advance porosity in a fluid time step without coupling 
+    /// exchange (couplingInterval > 1), porosity is interpolated between exchanges.
+    virtual
+    void interpolatePorosity() =0;
+
     /// Pure virtual method to calculate momentum coupling between particles and fluid.
     virtual
     void calculateMomentumCoupling() = 0;
@@ -166,20 +258,28 @@ public:
     virtual
     void calculateMassCoupling() = 0;
 
-    /// Pure virtual method returning the fluid volume fraction field (porosity).
+    /// Pure virtual method returning the fluid volume fraction field (porosity) of the fluid 
+    /// equations. With couplingInterval > 1, it is interpolated over the interval, while drag 
+    /// and averaging use the porosity of the last exchange.
     /// @return Const reference to the volScalarField alpha representing porosity.
     virtual 
     const Foam::volScalarField& alpha()const =0;
 
     /// Pure virtual method returning the implicit coefficient of momentum source term (Sp in Sp*U+Su).
-    /// @return Temporary volScalarField containing the implicit momentum source coefficient.
+    /// Source terms are assembled once per coupling step and can be used in all outer iterations.
+    /// @return Const reference to the volScalarField of the implicit momentum source coefficient.
+    virtual
+    const Foam::volScalarField& Sp()const =0;
+
+    /// Pure virtual method returning the drag coefficient without the semi-implicit factor 
+    /// of drag (equal to Sp for explicit drag), used for the relaxation time of drag coupling.
     virtual
-    Foam::tmp<Foam::volScalarField> Sp()const =0;
+    const Foam::volScalarField& SpExplicit()const =0;
 
     /// Pure virtual method returning the explicit part of momentum source term (Su in Sp*U+Su).
-    /// @return Temporary volVectorField containing the explicit momentum source.
+    /// @return Const reference to the volVectorField of the explicit momentum source.
     virtual
-    Foam::tmp<Foam::volVectorField> Su()const =0;
+    const Foam::volVectorField& Su()const =0;
 
     /// Pure virtual method returning the heat source term for the energy equation.
     /// @return Temporary volScalarField containing the heat source.